@@ -0,0 +1,180 @@
+/***************************************************************************//**
+* \file cyhal_adc_impl.h
+*
+* \brief
+* Implementation details of Infineon ADC.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "cyhal_adc.h"
+
+#if (CYHAL_DRIVER_AVAILABLE_ADC)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \addtogroup group_hal_impl_adcmic
+ * \{
+ * \section section_hal_impl_adcmic_continuous Timer-paced continuous acquisition
+ * The ADC has no trigger inputs, so \ref cyhal_adc_read_async runs its scans back to back.
+ * \ref cyhal_adc_continuous_start instead starts one scan of all enabled channels on each
+ * terminal count of an application-provided timer, and stores the results in an application
+ * ring buffer until \ref cyhal_adc_continuous_stop is called. The CPU is only woken by the timer
+ * and by the end of each conversion. Continuous acquisition, \ref cyhal_adc_read_async and the
+ * blocking reads cannot be used at the same time.
+ *
+ * \section section_hal_impl_adcmic_averaging Oversampling
+ * When average_count in @ref cyhal_adc_config_t is greater than 1, each result of a channel with
+ * enable_averaging set is built from average_count back-to-back conversions of that channel,
+ * accumulated in the conversion interrupt. One API call therefore returns a filtered result.
+ * average_count can be 1 to \ref CYHAL_ADC_MAX_AVERAGE_COUNT, and average_mode_flags selects:
+ * * @ref CYHAL_ADC_AVG_MODE_AVERAGE: boxcar average of the conversions.
+ * * @ref CYHAL_ADC_AVG_MODE_ACCUMULATE: sum of the conversions, for up to 8 extra bits of
+ *   resolution. \ref cyhal_adc_read_u16 still returns the average.
+ * * \ref CYHAL_ADC_AVG_MODE_EXPONENTIAL: each conversion updates a per-channel exponential
+ *   filter with a weight of 1 / average_count, which keeps its state across reads.
+ *
+ * Averaged results in microvolts are interpolated between neighbouring counts, so they keep the
+ * extra resolution of the average.
+ *
+ * \section section_hal_impl_adcmic_calibration Stored DC calibration
+ * \ref cyhal_adc_init runs a DC offset calibration before the first DC measurement, and reads
+ * return a default value until it has completed. The result can be exported with
+ * \ref cyhal_adc_get_calibration and passed to \ref cyhal_adc_init_calibrated on a later warm
+ * boot or wake from deep sleep, which then only waits for the ADC to power up. The HAL has no
+ * temperature sensor of its own, so the application provides the temperature, in any unit, when
+ * exporting and restoring; the stored calibration is only used if the two are close enough.
+ */
+
+/** Maximum number of conversions per oversampled result */
+#define CYHAL_ADC_MAX_AVERAGE_COUNT       (256u)
+
+/** Exponential filter instead of a boxcar average, see \ref section_hal_impl_adcmic_averaging.
+ * Cannot be combined with @ref CYHAL_ADC_AVG_MODE_ACCUMULATE. */
+#define CYHAL_ADC_AVG_MODE_EXPONENTIAL    (1u << (CYHAL_ADC_AVG_MODE_MAX_SHIFT + 1u))
+
+/** Starts timer-paced continuous acquisition into a ring buffer.
+ *
+ * The timer (TCPWM or T2 timer) must have been initialized and configured by the application
+ * as a continuous timer whose period is the scan interval. This function registers the ADC
+ * callback on the timer, enables its terminal count event and starts it.
+ * Each scan stores one result per enabled channel, in channel order. A scan is skipped if the
+ * ring cannot hold all of its results or if the previous scan has not completed yet.
+ * @ref CYHAL_ADC_ASYNC_READ_COMPLETE is raised at the end of a scan when the number of unread
+ * results reaches the watermark.
+ *
+ * @param[in] obj       The ADC object. It must have completed its DC calibration.
+ * @param[in] timer     The timer that paces the scans. It must remain valid until
+ *                      \ref cyhal_adc_continuous_stop is called.
+ * @param[in] ring      The ring buffer
+ * @param[in] size      The size of the ring in results. Must be a non-zero multiple of the
+ *                      number of enabled channels, so that scans do not wrap around.
+ * @param[in] watermark The number of unread results that raises the event, from 1 to size
+ * @param[in] in_uv     Whether results are stored in microvolts instead of counts
+ * @return The status of the start request
+ */
+cy_rslt_t cyhal_adc_continuous_start(cyhal_adc_t *obj, cyhal_timer_t *timer, int32_t *ring, size_t size,
+                                     size_t watermark, bool in_uv);
+
+/** Stops continuous acquisition started by \ref cyhal_adc_continuous_start and stops its timer.
+ *
+ * Results that have not been consumed are discarded.
+ *
+ * @param[in] obj   The ADC object
+ * @return The status of the stop request
+ */
+cy_rslt_t cyhal_adc_continuous_stop(cyhal_adc_t *obj);
+
+/** Returns the oldest results that have not been consumed yet.
+ *
+ * The returned span is contiguous in memory and always holds whole scans; call this again after
+ * consuming it to get the results that follow a wrap-around.
+ *
+ * @param[in]  obj   The ADC object
+ * @param[out] data  Set to the consumer position in the ring
+ * @return The number of results available at data
+ */
+size_t cyhal_adc_continuous_peek(cyhal_adc_t *obj, const int32_t **data);
+
+/** Releases results returned by \ref cyhal_adc_continuous_peek back to the ring.
+ *
+ * @param[in] obj    The ADC object
+ * @param[in] length The number of results to release. Must not exceed the value returned by
+ *                   \ref cyhal_adc_continuous_peek.
+ */
+void cyhal_adc_continuous_consume(cyhal_adc_t *obj, size_t length);
+
+/** Returns the number of scans skipped since \ref cyhal_adc_continuous_start because the ring
+ * was full or the previous scan was still running.
+ *
+ * @param[in] obj    The ADC object
+ * @return The number of skipped scans
+ */
+uint32_t cyhal_adc_continuous_get_skipped(const cyhal_adc_t *obj);
+
+/** Initialize the ADC from a stored DC calibration.
+ *
+ * Behaves like \ref cyhal_adc_init, except that the stored offset and gain are applied as soon as
+ * the ADC is ready, instead of running the calibration sequence. If the record is invalid (for
+ * example erased flash) or the temperature differs by more than max_temperature_delta from the
+ * one it was recorded at, the ADC is calibrated as usual.
+ *
+ * @param[out] obj                   The ADC object to initialize
+ * @param[in]  pin                   A pin corresponding to the ADC block to initialize
+ * @param[in]  clk                   The clock to use can be shared, if not provided a new clock will be allocated
+ * @param[in]  cal                   The stored calibration record, may be NULL
+ * @param[in]  temperature           The current temperature, in the units used for \ref cyhal_adc_get_calibration
+ * @param[in]  max_temperature_delta The largest temperature difference for which cal is used
+ * @return The status of the init request
+ */
+cy_rslt_t cyhal_adc_init_calibrated(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk,
+                                    const cyhal_adc_calibration_t *cal, int16_t temperature,
+                                    uint16_t max_temperature_delta);
+
+/** Exports the DC calibration of the ADC so that it can be stored.
+ *
+ * @param[in]  obj          The ADC object
+ * @param[in]  temperature  The current temperature, in any unit the application uses consistently
+ * @param[out] cal          The calibration record
+ * @return The status of the request. @ref CYHAL_ADC_RSLT_ERR_BUSY is returned if the calibration
+ * has not completed yet.
+ */
+cy_rslt_t cyhal_adc_get_calibration(const cyhal_adc_t *obj, int16_t temperature, cyhal_adc_calibration_t *cal);
+
+/** Returns whether the DC calibration has been completed or restored, that is whether DC
+ * measurements return valid results.
+ *
+ * @param[in] obj   The ADC object
+ * @return Whether the ADC is calibrated
+ */
+bool cyhal_adc_is_calibrated(const cyhal_adc_t *obj);
+
+/** \} group_hal_impl_adcmic */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* CYHAL_DRIVER_AVAILABLE_ADC */
@@ -107,6 +107,8 @@ cy_rslt_t _cyhal_audioss_stop_rx(_cyhal_audioss_t *obj);
 
 cy_rslt_t _cyhal_audioss_clear_rx(_cyhal_audioss_t *obj);
 
+cy_rslt_t _cyhal_audioss_start_duplex(_cyhal_audioss_t *obj, uint32_t *start_ticks);
+
 cy_rslt_t _cyhal_audioss_read(_cyhal_audioss_t *obj, void *data, size_t* length);
 
 cy_rslt_t _cyhal_audioss_write(_cyhal_audioss_t *obj, const void *data, size_t *length);
@@ -133,10 +135,54 @@ cy_rslt_t _cyhal_audioss_abort_read_async(_cyhal_audioss_t *obj);
 
 cy_rslt_t _cyhal_audioss_abort_write_async(_cyhal_audioss_t *obj);
 
+cy_rslt_t _cyhal_audioss_write_circular(_cyhal_audioss_t *obj, const void *tx, size_t period_length, size_t num_periods);
+
+cy_rslt_t _cyhal_audioss_read_circular(_cyhal_audioss_t *obj, void *rx, size_t period_length, size_t num_periods);
+
+cy_rslt_t _cyhal_audioss_queue_write_async(_cyhal_audioss_t *obj, const void *tx, size_t tx_length);
+
+cy_rslt_t _cyhal_audioss_queue_read_async(_cyhal_audioss_t *obj, void *rx, size_t rx_length);
+
+cy_rslt_t _cyhal_audioss_read_demux_async(_cyhal_audioss_t *obj, void * const *slot_buffers, uint8_t num_slots, size_t frames);
+
+cy_rslt_t _cyhal_audioss_start_rate_measurement(_cyhal_audioss_t *obj, bool is_tx, uint32_t ref_ticks);
+
+cy_rslt_t _cyhal_audioss_get_measured_rate(_cyhal_audioss_t *obj, bool is_tx, uint32_t ref_ticks, uint32_t ref_hz, uint32_t *rate_millihz);
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+cy_rslt_t _cyhal_audioss_get_stats(_cyhal_audioss_t *obj, _cyhal_audioss_stats_t *stats);
+
+void _cyhal_audioss_clear_stats(_cyhal_audioss_t *obj);
+#endif
+
 cy_rslt_t _cyhal_audioss_enable_output(_cyhal_audioss_t *obj, bool is_rx, cyhal_source_t *source);
 
 cy_rslt_t _cyhal_audioss_disable_output(_cyhal_audioss_t *obj, bool is_rx);
 
+void _cyhal_audioss_pack_24(uint8_t *dst, const int32_t *src, size_t count);
+
+void _cyhal_audioss_unpack_24(int32_t *dst, const uint8_t *src, size_t count);
+
+void _cyhal_audioss_convert_16_to_32(int32_t *dst, const int16_t *src, size_t count, uint8_t shift);
+
+void _cyhal_audioss_convert_32_to_16(int16_t *dst, const int32_t *src, size_t count, uint8_t shift);
+
+void _cyhal_audioss_interleave_16(int16_t *dst, const int16_t *left, const int16_t *right, size_t frames);
+
+void _cyhal_audioss_deinterleave_16(int16_t *left, int16_t *right, const int16_t *src, size_t frames);
+
+void _cyhal_audioss_interleave_32(int32_t *dst, const int32_t *left, const int32_t *right, size_t frames);
+
+void _cyhal_audioss_deinterleave_32(int32_t *left, int32_t *right, const int32_t *src, size_t frames);
+
+void _cyhal_audioss_src_init(_cyhal_audioss_src_t *src, uint8_t num_channels);
+
+void _cyhal_audioss_src_set_ratio(_cyhal_audioss_src_t *src, uint32_t in_rate_millihz, uint32_t out_rate_millihz);
+
+size_t _cyhal_audioss_src_process_16(_cyhal_audioss_src_t *src, int16_t *dst, size_t dst_frames, const int16_t *in, size_t *in_frames);
+
+size_t _cyhal_audioss_src_process_32(_cyhal_audioss_src_t *src, int32_t *dst, size_t dst_frames, const int32_t *in, size_t *in_frames);
+
 /** \endcond */
 
 #if defined(__cplusplus)
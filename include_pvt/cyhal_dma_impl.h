@@ -65,10 +65,42 @@ extern "C" {
  * - M2M and M2P transactions are mapped to channel 1.
  * - P2M transactions are mapped to 2.
  * 
+ * Several DMA objects may share a channel, for example UARTs or SPIs on different SCBs. Only
+ * one request is handed to the DMA controller at a time; \ref cyhal_dma_start_transfer queues the
+ * request of any other object behind it, and queued requests are started in submission order as
+ * the channel becomes free. Each object keeps its own configuration and callback. A queued request
+ * is reported as busy by \ref cyhal_dma_is_busy and is removed from the queue by \ref cyhal_dma_disable.
+ * The channel is handed over from the completion interrupt, which is therefore raised for every
+ * non-circular transfer; the \ref CYHAL_DMA_TRANSFER_COMPLETE event is only passed on to the
+ * callback if it has been enabled. A queued request that the DMA controller refuses to start is
+ * reported with \ref CYHAL_DMA_GENERIC_ERROR once the driver has left its critical section.
+ * A circular transfer never completes, so it keeps the channel, and requests queued behind it
+ * wait, until it is disabled.
+ * 
  * Note: If BT/BLE is not used, or if you'd like to customize your channel use,
  * you can manually modify the channel number in cyhal_dma_t after the initialization
  * and configuration of the DMA object.
  * 
+ * \section section_dma_priority Priority and Burst Size
+ * The DMA controller arbitrates between channels in fixed order, channel 0 having the highest
+ * priority, and the channel of each transfer is fixed by its peripheral, so the priority cannot
+ * change the hardware arbitration. The priority passed to \ref cyhal_dma_init_adv orders the
+ * requests of objects waiting for the same channel instead: higher priority requests are started
+ * first, and requests of equal priority are started in submission order. Values beyond
+ * \ref CYHAL_DMA_PRIORITY_LOW are treated as \ref CYHAL_DMA_PRIORITY_LOW.
+ *
+ * If \ref cyhal_dma_cfg_t.burst_size is set to \ref CYHAL_DMA_BURST_SIZE_AUTO, the largest
+ * supported burst that does not exceed the transfer length is used, limited to half of the FIFO
+ * depth when one end of the transfer is an SCB or TDM FIFO. When the source is a peripheral, the
+ * burst also divides the transfer length, so that the transfer does not end on a partial burst
+ * that the peripheral never requests.
+ *
+ * \section section_dma_stats Statistics
+ * When CYHAL_DMA_STATS_ENABLED is defined, the driver keeps transfer statistics for each DMA
+ * channel, which can be read with \ref cyhal_dma_get_stats. Times are measured in ticks of
+ * CYHAL_DMA_STATS_GET_TICKS(), which defaults to the CPU cycle counter (DWT->CYCCNT) and may be
+ * defined by the application to use a different free-running counter.
+ *
  * \section section_dma_limitations Limitations
  * The DMA on this device only supports the CYHAL_DMA_TRANSFER_FULL transfer.
  * It does not support,
@@ -76,16 +108,37 @@ extern "C" {
  * - CYHAL_DMA_TRANSFER_BURST_DISABLE
  * - CYHAL_DMA_TRANSFER_FULL_DISABLE
  * 
+ * \section section_dma_scatter_gather Scatter-Gather Transfers
+ * \ref cyhal_dma_configure_chain programs several non-contiguous segments into a single request
+ * using the linked list items (LLI) of the DMA controller. The segments are transferred back to
+ * back after a single \ref cyhal_dma_start_transfer and only the last segment raises the
+ * \ref CYHAL_DMA_TRANSFER_COMPLETE event.
+ *
+ * \ref cyhal_dma_configure_circular links the last segment back to the first one, so the
+ * transfer runs continuously without any reprogramming by the CPU. Every segment raises the
+ * \ref CYHAL_DMA_TRANSFER_COMPLETE event when it finishes. A circular transfer only stops
+ * when \ref cyhal_dma_disable is called.
+ *
+ * \section section_dma_memcpy Memory Copies
+ * \ref cyhal_dma_memcpy_async and \ref cyhal_dma_memset_async offload bulk copies and fills to a DMA
+ * object initialized with \ref CYHAL_DMA_DIRECTION_MEM2MEM. Requests are queued on the object and
+ * serviced in order. Each request is split into transfers of at most 4095 elements, using the widest
+ * transfer width that the addresses are aligned to. The object is dedicated to these requests: its
+ * callback is owned by the driver and each request reports to its own callback instead.
+ * 
  */
 
-/** Default DMA channel priority */
-#define CYHAL_DMA_PRIORITY_DEFAULT              0u
 /** High DMA channel priority */
 #define CYHAL_DMA_PRIORITY_HIGH                 0u
 /** Medium DMA channel priority */
-#define CYHAL_DMA_PRIORITY_MEDIUM               0u
+#define CYHAL_DMA_PRIORITY_MEDIUM               1u
 /** Low DMA channel priority */
-#define CYHAL_DMA_PRIORITY_LOW                  0u
+#define CYHAL_DMA_PRIORITY_LOW                  2u
+/** Default DMA channel priority */
+#define CYHAL_DMA_PRIORITY_DEFAULT              CYHAL_DMA_PRIORITY_HIGH
+
+/** Value of \ref cyhal_dma_cfg_t.burst_size that selects the burst size automatically */
+#define CYHAL_DMA_BURST_SIZE_AUTO               (0xFFFFFFFFu)
 
 /** Channel dedicated to memory-UART transactions */
 #define _CYHAL_DMA_CH_PERIPH_TO_MEM             2u
@@ -141,6 +194,98 @@ extern "C" {
 /** End of TDM1 address */
 #define _CYHAL_DMA_ADDR_TDM1_END                (_CYHAL_DMA_ADDR_TDM0_END + _CYHAL_DMA_TDM_STRUCT_SIZE)
 
+/** Configures the DMA channel to transfer several segments as a single scatter-gather transfer.
+ *
+ * The first segment is programmed into the DMA request just as \ref cyhal_dma_configure would.
+ * Each remaining segment is described by a linked list item in \p lli, which the controller
+ * fetches when the previous segment completes. All segments must target the same peripheral;
+ * the channel is selected based on the first segment.
+ *
+ * @param[in]  obj          The DMA object
+ * @param[in]  cfg          Array of \p num_segments segment configurations, in transfer order
+ * @param[in]  num_segments Number of segments in \p cfg
+ * @param[out] lli          Caller allocated storage for (\p num_segments - 1) linked list items.
+ * The storage must remain valid until the transfer completes. May be NULL when \p num_segments is 1.
+ * @return The status of the configure request
+ */
+cy_rslt_t cyhal_dma_configure_chain(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, size_t num_segments, cyhal_dma_lli_t *lli);
+
+/** Configures the DMA channel to transfer several segments in a continuous loop.
+ *
+ * This behaves like \ref cyhal_dma_configure_chain except that the transfer restarts from the
+ * first segment once the last one completes, and every segment raises the completion event.
+ *
+ * @param[in]  obj          The DMA object
+ * @param[in]  cfg          Array of \p num_segments segment configurations, in transfer order
+ * @param[in]  num_segments Number of segments in \p cfg
+ * @param[out] lli          Caller allocated storage for \p num_segments linked list items.
+ * The storage must remain valid until the DMA is disabled.
+ * @return The status of the configure request
+ */
+cy_rslt_t cyhal_dma_configure_circular(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, size_t num_segments, cyhal_dma_lli_t *lli);
+
+/** Queues an asynchronous copy of a block of memory.
+ *
+ * @param[in]  obj          The DMA object, initialized with \ref CYHAL_DMA_DIRECTION_MEM2MEM
+ * @param[out] req          Caller allocated storage for the request. It must remain valid until
+ * \p callback is called.
+ * @param[out] dst          Destination address
+ * @param[in]  src          Source address
+ * @param[in]  length       Number of bytes to copy
+ * @param[in]  callback     Called with \ref CYHAL_DMA_TRANSFER_COMPLETE once the copy is done, or with
+ * \ref CYHAL_DMA_GENERIC_ERROR if it failed. May be NULL.
+ * @param[in]  callback_arg Argument passed to \p callback
+ * @return The status of the request. If an error is returned, \p callback will not be called.
+ */
+cy_rslt_t cyhal_dma_memcpy_async(cyhal_dma_t *obj, cyhal_dma_copy_t *req, void *dst, const void *src, size_t length,
+                                 cyhal_dma_event_callback_t callback, void *callback_arg);
+
+/** Queues an asynchronous fill of a block of memory with a byte value.
+ *
+ * @param[in]  obj          The DMA object, initialized with \ref CYHAL_DMA_DIRECTION_MEM2MEM
+ * @param[out] req          Caller allocated storage for the request. The fill pattern is read from
+ * it, so it must be located in SRAM and remain valid until \p callback is called.
+ * @param[out] dst          Destination address
+ * @param[in]  value        Value to write to every byte
+ * @param[in]  length       Number of bytes to fill
+ * @param[in]  callback     Called with \ref CYHAL_DMA_TRANSFER_COMPLETE once the fill is done, or with
+ * \ref CYHAL_DMA_GENERIC_ERROR if it failed. May be NULL.
+ * @param[in]  callback_arg Argument passed to \p callback
+ * @return The status of the request. If an error is returned, \p callback will not be called.
+ */
+cy_rslt_t cyhal_dma_memset_async(cyhal_dma_t *obj, cyhal_dma_copy_t *req, void *dst, uint8_t value, size_t length,
+                                 cyhal_dma_event_callback_t callback, void *callback_arg);
+
+#if defined(CYHAL_DMA_STATS_ENABLED)
+/** DMA channel statistics. All times are in ticks of CYHAL_DMA_STATS_GET_TICKS(). */
+typedef struct
+{
+    uint32_t bytes;                 //!< Number of bytes moved by the completed transfers
+    uint32_t transfers;             //!< Number of completed transfers, or segments of a circular transfer
+    uint32_t errors;                //!< Number of transfers that ended with an error
+    uint32_t queue_wait_ticks;      //!< Total time the requests waited for the channel to become free
+    uint32_t queue_wait_max_ticks;  //!< Longest time a request waited for the channel to become free
+    uint32_t latency_ticks;         //!< Total time from the start of a transfer to its completion
+    uint32_t latency_max_ticks;     //!< Longest time from the start of a transfer to its completion
+} cyhal_dma_stats_t;
+
+/** Reads the statistics of the channel used by the DMA object.
+ *
+ * The statistics are shared by all objects that use the same channel.
+ *
+ * @param[in]  obj   The DMA object
+ * @param[out] stats The channel statistics
+ * @return The status of the request
+ */
+cy_rslt_t cyhal_dma_get_stats(cyhal_dma_t *obj, cyhal_dma_stats_t *stats);
+
+/** Resets the statistics of the channel used by the DMA object.
+ *
+ * @param[in]  obj   The DMA object
+ */
+void cyhal_dma_clear_stats(cyhal_dma_t *obj);
+#endif /* defined(CYHAL_DMA_STATS_ENABLED) */
+
 /** \} group_hal_impl_dma */
 
 #if defined(__cplusplus)
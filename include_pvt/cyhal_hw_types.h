@@ -79,6 +79,10 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+#include "cyabs_rtos.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -94,17 +98,22 @@ extern "C" {
 * \cond INTERNAL
 */
 
+#define CYHAL_ADC_IMPL_HEADER           "cyhal_adc_impl.h"      //!< Implementation specific header for ADC
 #define CYHAL_CLOCK_IMPL_HEADER         "cyhal_clock_impl.h"    //!< Implementation specific header for Clocks
 #define CYHAL_DMA_IMPL_HEADER           "cyhal_dma_impl.h"      //!< Implementation specific header for DMA
 #define CYHAL_GPIO_IMPL_HEADER          "cyhal_gpio_impl.h"     //!< Implementation specific header for GPIO
 #define CYHAL_I2S_IMPL_HEADER           "cyhal_i2s_impl.h"      //!< Implementation specific header for I2S
+#define CYHAL_PDMPCM_IMPL_HEADER        "cyhal_pdmpcm_impl.h"   //!< Implementation specific header for PDM/PCM
 #define CYHAL_PWM_IMPL_HEADER           "cyhal_pwm_impl.h"      //!< Implementation specific header for PWM
+#define CYHAL_QSPI_IMPL_HEADER          "cyhal_qspi_impl.h"     //!< Implementation specific header for QSPI
 #define CYHAL_QUADDEC_IMPL_HEADER       "cyhal_quaddec_impl.h"  //!< Implementation specific header for Quaddec
 #define CYHAL_RTC_IMPL_HEADER           "cyhal_rtc_impl.h"      //!< Implementation specific header for RTC
+#define CYHAL_SPI_IMPL_HEADER           "cyhal_spi_impl.h"      //!< Implementation specific header for SPI
 #define CYHAL_SYSTEM_IMPL_HEADER        "cyhal_system_impl.h"   //!< Implementation specific header for System
 #define CYHAL_SYSPM_IMPL_HEADER         "cyhal_syspm_impl.h"    //!< Implementation specific header for System Power Management
 #define CYHAL_TDM_IMPL_HEADER           "cyhal_tdm_impl.h"      //!< Implementation specific header for TDM
 #define CYHAL_TIMER_IMPL_HEADER         "cyhal_timer_impl.h"    //!< Implementation specific header for Timer
+#define CYHAL_UART_IMPL_HEADER          "cyhal_uart_impl.h"     //!< Implementation specific header for UART
 
 /** \endcond */
 
@@ -190,6 +199,43 @@ typedef struct {
     cyhal_source_t                      inputs[5];
 } cyhal_tcpwm_t;
 
+/**
+  * @brief DMA linked list item
+  *
+  * Describes one segment of a scatter-gather transfer. The layout matches the DMACCxLLI
+  * descriptor format that is fetched by the DMA controller, so items must be word aligned and
+  * must remain valid until the transfer has completed. See \ref cyhal_dma_configure_chain.
+  */
+typedef struct _cyhal_dma_lli_s { /* Explicit name to allow the self reference below */
+    uint32_t                            src_addr;
+    uint32_t                            dst_addr;
+    struct _cyhal_dma_lli_s*            next;
+    uint32_t                            control;
+} cyhal_dma_lli_t;
+
+/**
+  * @brief DMA memory copy request
+  *
+  * Caller allocated storage for one \ref cyhal_dma_memcpy_async or \ref cyhal_dma_memset_async
+  * request. It must remain valid until the completion callback of the request has been called.
+  *
+  * Application code should not rely on the specific contents of this struct.
+  * They are considered an implementation detail which is subject to change
+  * between platforms and/or HAL releases.
+  */
+typedef struct _cyhal_dma_copy_s { /* Explicit name to allow the self reference below */
+    uint32_t                            src_addr;
+    uint32_t                            dst_addr;
+    size_t                              remaining;
+    /* Number of bytes moved by the transfer in progress */
+    size_t                              chunk;
+    /* Fill pattern for memset requests, replicated to every byte of the word */
+    uint32_t                            fill;
+    bool                                is_fill;
+    cyhal_event_callback_data_t         callback_data;
+    struct _cyhal_dma_copy_s*           next;
+} cyhal_dma_copy_t;
+
 /* This is presented out of order because many other structs depend on it */
 /**
   * @brief DMA object
@@ -198,13 +244,37 @@ typedef struct {
   * They are considered an implementation detail which is subject to change
   * between platforms and/or HAL releases.
   */
-typedef struct {
+typedef struct _cyhal_dma_s { /* Explicit name to allow the self reference below */
     cyhal_resource_inst_t               resource;
     bool                                is_enabled;
+    uint8_t                             priority;
     BTSS_DMAC_CONFIG_REG_FLOWCONTROL_t  transfer_type;
     BTSS_DMAC_CONTROL_LINE_t            src_ctrl;
     BTSS_DMAC_CONTROL_LINE_t            dest_ctrl;
     BTSS_DMAC_APP_REQUEST_t             dma_req;
+    /* Last linked list item of a scatter-gather transfer, NULL for a single segment. It points into
+     * caller storage, so it is cleared once the transfer has completed or been stopped. */
+    cyhal_dma_lli_t*                    lli_tail;
+    /* Set once the scatter-gather transfer described by lli_tail has been started */
+    bool                                lli_started;
+    /* Completion interrupt enablement, applied to every configuration */
+    bool                                int_enabled;
+    /* Set while a circular transfer is configured; it holds the channel until it is disabled */
+    bool                                is_circular;
+    /* Set while the request is waiting for its channel to be released by another object */
+    volatile bool                       is_queued;
+    /* Next request waiting for the same channel */
+    struct _cyhal_dma_s*                queue_next;
+    /* Request started as soon as this one has been handed to the DMA controller, or NULL */
+    struct _cyhal_dma_s*                start_linked;
+    /* Pending memory copy requests, serviced in order */
+    cyhal_dma_copy_t*                   copy_head;
+    cyhal_dma_copy_t*                   copy_tail;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+    uint32_t                            stats_bytes;
+    uint32_t                            stats_submit_ticks;
+    uint32_t                            stats_start_ticks;
+#endif
     cyhal_event_callback_data_t         callback_data;
 } cyhal_dma_t;
 
@@ -224,6 +294,70 @@ typedef struct
 
 struct _cyhal_audioss_s;
 
+/** \cond INTERNAL */
+/** Maximum number of periods in a circular audio DMA ring */
+#define _CYHAL_AUDIOSS_MAX_PERIODS      (4u)
+
+/** A buffer waiting behind the active I2S/TDM async transfer */
+typedef struct
+{
+    void                                *buff;
+    size_t                              length;
+} _cyhal_audioss_queue_entry_t;
+/** \endcond */
+
+#if !defined(CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH)
+/** Number of buffers that can be queued behind the active I2S/TDM async transfer in each
+ * direction. Must be at least 1. */
+#define CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH (4u)
+#endif
+
+/** Maximum number of frames by which transmit can start after receive in cyhal_i2s_start_duplex and
+ * cyhal_tdm_start_duplex. The MXTDM block has no command that starts both directions at once, so
+ * a frame edge can fall between the two register writes that start them. */
+#if defined(CY_IP_MXTDM)
+#define CYHAL_AUDIOSS_DUPLEX_MAX_SKEW_FRAMES    (1u)
+#else
+#define CYHAL_AUDIOSS_DUPLEX_MAX_SKEW_FRAMES    (0u)
+#endif
+
+#if !defined(CYHAL_AUDIOSS_SRC_MAX_CHANNELS)
+/** Maximum number of interleaved channels handled by an I2S/TDM sample rate converter */
+#define CYHAL_AUDIOSS_SRC_MAX_CHANNELS  (8u)
+#endif
+
+/**
+  * @brief State of an I2S/TDM fractional sample rate converter
+  *
+  * Application code should not rely on the specific contents of this struct.
+  * They are considered an implementation detail which is subject to change
+  * between platforms and/or HAL releases.
+  */
+typedef struct
+{
+    /* Input frames per output frame, in Q2.30 */
+    uint32_t                            step;
+    /* Position of the next output frame after prev, in Q2.30 */
+    uint32_t                            phase;
+    uint8_t                             num_channels;
+    /* Last input frame consumed */
+    int32_t                             prev[CYHAL_AUDIOSS_SRC_MAX_CHANNELS];
+} _cyhal_audioss_src_t;
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+/** I2S/TDM FIFO and interrupt statistics. All times are in ticks of CYHAL_AUDIOSS_STATS_GET_TICKS(). */
+typedef struct
+{
+    uint32_t tx_underruns;          //!< Number of TX FIFO underflows while an async write was in progress
+    uint32_t rx_overruns;           //!< Number of RX FIFO overflows while an async read was in progress
+    uint32_t tx_fifo_min;           //!< Lowest TX FIFO level seen on entry to the TX interrupt
+    uint32_t rx_fifo_max;           //!< Highest RX FIFO level seen on entry to the RX interrupt
+    uint32_t isr_count;             //!< Number of interrupts serviced
+    uint32_t isr_ticks;             //!< Total time spent servicing the interrupts
+    uint32_t isr_max_ticks;         //!< Longest time spent servicing one interrupt
+} _cyhal_audioss_stats_t;
+#endif
+
 /**
   * @brief Interface to abstract away the driver-specific differences between TDM and I2S
   *
@@ -252,6 +386,10 @@ typedef struct
     uint32_t event_rx_complete;
     /** HAL event mask that represents async tx complete */
     uint32_t event_tx_complete;
+    /** HAL event mask that represents a tx FIFO underflow */
+    uint32_t event_tx_underflow;
+    /** HAL event mask that represents an rx FIFO overflow */
+    uint32_t event_rx_overflow;
     /** Error code for invalid pin */
     cy_rslt_t err_invalid_pin;
     /** Error code for invalid argument */
@@ -260,6 +398,8 @@ typedef struct
     cy_rslt_t err_clock;
     /** Error code for configuration not supported */
     cy_rslt_t err_not_supported;
+    /** Error code for a full async queue */
+    cy_rslt_t err_busy;
 } _cyhal_audioss_interface_t;
 
 /**
@@ -305,6 +445,38 @@ typedef struct _cyhal_audioss_s { /* Explicit name to enable forward declaration
     volatile size_t                 async_tx_length;
     volatile void                   *async_rx_buff;
     volatile size_t                 async_rx_length;
+    // Circular DMA transfers run over the async buffers until they are aborted
+    volatile bool                   tx_circular;
+    volatile bool                   rx_circular;
+    cyhal_dma_lli_t                 tx_lli[_CYHAL_AUDIOSS_MAX_PERIODS];
+    cyhal_dma_lli_t                 rx_lli[_CYHAL_AUDIOSS_MAX_PERIODS];
+    // Buffers that continue the async transfers once the current buffer is done
+    _cyhal_audioss_queue_entry_t    tx_queue[CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH];
+    volatile uint8_t                tx_queue_head;
+    volatile uint8_t                tx_queue_count;
+    _cyhal_audioss_queue_entry_t    rx_queue[CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH];
+    volatile uint8_t                rx_queue_head;
+    volatile uint8_t                rx_queue_count;
+    // Per-slot receive buffers of a demultiplexing read; rx_demux_num_slots is 0 otherwise
+    void * const                    *rx_demux_buffers;
+    uint8_t                         rx_demux_num_slots;
+    uint8_t                         rx_demux_slot;
+    size_t                          rx_demux_frame;
+    // Words moved through each FIFO by the driver, for the sample rate measurement
+    volatile uint32_t               tx_word_count;
+    volatile uint32_t               rx_word_count;
+    // Words of the DMA transfer in flight, added to the word count once it has completed
+    volatile uint32_t               tx_dma_pending_words;
+    volatile uint32_t               rx_dma_pending_words;
+    size_t                          tx_period_length;
+    size_t                          rx_period_length;
+    uint32_t                        tx_rate_start_words;
+    uint32_t                        tx_rate_start_ticks;
+    uint32_t                        rx_rate_start_words;
+    uint32_t                        rx_rate_start_ticks;
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    _cyhal_audioss_stats_t          stats;
+#endif
     volatile bool                   pm_transition_ready;
     cyhal_syspm_callback_data_t     pm_callback;
     const _cyhal_audioss_interface_t *interface;
@@ -330,6 +502,20 @@ typedef struct
 } _cyhal_audioss_configurator_t;
 
 struct _cyhal_adc_channel_s;
+struct _cyhal_timer_s;
+
+/** \cond INTERNAL */
+/** Completion object used by blocking driver calls to wait for their completion interrupt, see
+ * _cyhal_utils_wait_arm(). Each driver object owns one per kind of blocking call. */
+typedef struct _cyhal_utils_wait
+{
+    volatile bool                       done;
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    bool                                has_semaphore;
+    cy_semaphore_t                      semaphore;
+#endif
+} _cyhal_utils_wait_t;
+/** \endcond */
 
 /**
   * @brief ADC object
@@ -355,8 +541,12 @@ typedef struct {
     bool                                dc_calibrated;
     bool                                dc_calibration_started;
     int16_t                             calibOffset;
+    /* A stored calibration is applied when the ADC becomes ready, instead of calibrating */
+    bool                                calib_restored;
     /* Has at least one conversion completed since the last configuration change */
     volatile bool                       conversion_complete;
+    struct _cyhal_utils_wait*           waiter;
+    _cyhal_utils_wait_t                 wait;
     bool                                stop_after_scan;
     uint8_t                             user_enabled_events;
     cyhal_event_callback_data_t         callback_data;
@@ -365,6 +555,27 @@ typedef struct {
     bool                                async_transfer_in_uv; /* Default is counts */
     /* Only decremented after all elements from a scan have been copied into async_buff */
     size_t                              async_scans_remaining;
+    /* Timer-paced continuous acquisition; cont_ring is NULL when not running */
+    struct _cyhal_timer_s*              cont_timer;
+    int32_t*                            cont_ring;
+    size_t                              cont_size;
+    size_t                              cont_watermark;
+    size_t                              cont_head;
+    size_t                              cont_tail;
+    volatile size_t                     cont_count;
+    uint32_t                            cont_skipped_scans;
+    uint8_t                             cont_scan_size;
+    uint8_t                             cont_scan_pos;
+    bool                                cont_in_uv;
+    bool                                cont_scan_active;
+    /* Oversampling, see cyhal_adc_configure(). The result of the last completed (possibly
+    * oversampled) conversion is kept both as an average in Q8 counts and as a plain sum. */
+    uint16_t                            average_count;
+    uint32_t                            average_mode_flags;
+    uint16_t                            avg_index;
+    int32_t                             avg_acc;
+    int32_t                             result_q8;
+    int32_t                             result_sum;
 } cyhal_adc_t;
 
 /**
@@ -405,8 +616,28 @@ typedef struct _cyhal_adc_channel_s { /* Struct given an explicit name to make t
     cy_en_adccomp_adc_dc_channel_t      channel_sel;
 #endif
     bool                                enabled;
+    bool                                enable_averaging;
+    /* State of the exponential filter (CYHAL_ADC_AVG_MODE_EXPONENTIAL), in Q8 counts */
+    bool                                filter_valid;
+    int32_t                             filter_q8;
 } cyhal_adc_channel_t;
 
+/**
+  * @brief ADC DC calibration record
+  *
+  * Produced by \ref cyhal_adc_get_calibration so that it can be stored, for example in flash
+  * or retained RAM, and passed to \ref cyhal_adc_init_calibrated on a later start.
+  */
+typedef struct
+{
+    uint32_t                            magic;          //!< Identifies a valid record of this format
+    int16_t                             offset;         //!< DC offset measured by the calibration
+    uint16_t                            gain;           //!< DC gain applied with the offset
+    int16_t                             temperature;    //!< Temperature at calibration, in the application's units
+    uint16_t                            reserved;       //!< Reserved, set to 0
+    uint32_t                            check;          //!< Check value over the other fields
+} cyhal_adc_calibration_t;
+
 /** @brief Comparator object */
 typedef struct {
     bool                                owned_by_configurator;
@@ -538,6 +769,20 @@ typedef _cyhal_audioss_t cyhal_i2s_t;
   */
 typedef _cyhal_audioss_configurator_t cyhal_i2s_configurator_t;
 
+/**
+  * @brief I2S fractional sample rate converter
+  *
+  * Application code should not rely on the specific contents of this struct.
+  * They are considered an implementation detail which is subject to change
+  * between platforms and/or HAL releases.
+  */
+typedef _cyhal_audioss_src_t cyhal_i2s_src_t;
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+/** I2S FIFO and interrupt statistics, see @ref cyhal_i2s_get_stats */
+typedef _cyhal_audioss_stats_t cyhal_i2s_stats_t;
+#endif
+
 /**
   * @brief LPTimer object
   *
@@ -549,6 +794,11 @@ typedef struct {
     void *empty;
 } cyhal_lptimer_t;
 
+/** \cond INTERNAL */
+/** Number of taps in the FIR filter used by PDM/PCM software decimation */
+#define _CYHAL_PDM_PCM_DECIM_TAPS       (15u)
+/** \endcond */
+
 /**
   * @brief PDM-PCM object
   *
@@ -572,6 +822,27 @@ typedef struct {
     int32_t                             events;
     void*                               async_data;  
     uint8_t*                            fifo_context;
+    /* Streaming receive ring; stream_ring is NULL when not streaming */
+    uint32_t*                           stream_ring;
+    size_t                              stream_size;
+    size_t                              stream_threshold;
+    size_t                              stream_head;
+    size_t                              stream_tail;
+    volatile size_t                     stream_count;
+    size_t                              stream_unreported;
+    struct _cyhal_utils_wait*           waiter;
+    _cyhal_utils_wait_t                 wait;
+    /* Software processing stage, see cyhal_pdm_pcm_set_dc_blocker() */
+    bool                                is_right;
+    int32_t                             gain;
+    uint16_t                            dc_pole;
+    int32_t                             dc_prev_in;
+    int32_t                             dc_prev_out;
+    int32_t                             dc_error;
+    uint8_t                             decimation;
+    uint8_t                             decim_phase;
+    uint8_t                             decim_pos;
+    int16_t                             decim_hist[_CYHAL_PDM_PCM_DECIM_TAPS];
     cyhal_event_callback_data_t         callback_data;
     bool                                pm_transition_pending;
     cyhal_syspm_callback_data_t         pm_callback_data;
@@ -643,6 +914,10 @@ typedef struct {
     en_hsiom_sel_t                      saved_ssel_hsiom[SMIF_CHIP_TOP_SPI_SEL_NR];
     /* Active slave select */
     cy_en_smif_slave_select_t           slave_select;
+    /* Data lines of each slave select, needed to set up the memory-mapped window */
+    cy_en_smif_data_select_t            data_select[SMIF_CHIP_TOP_SPI_SEL_NR];
+    /* Memory-mapped (XIP) mode is enabled; command mode transfers are not available */
+    bool                                xip_enabled;
     cyhal_clock_t                       clock;
     bool                                is_clock_owned;
     uint8_t                             mode;
@@ -782,6 +1057,10 @@ typedef struct {
     bool                                pm_transition_pending;
     cyhal_syspm_callback_data_t         pm_callback_data;
     cyhal_sdio_buffer_t                 buffer;
+    struct _cyhal_utils_wait*           rx_waiter;
+    struct _cyhal_utils_wait*           tx_waiter;
+    _cyhal_utils_wait_t                 rx_wait;
+    _cyhal_utils_wait_t                 tx_wait;
 #else
     void                                *empty;
 #endif /* (CYHAL_DRIVER_AVAILABLE_SDIO_DEV) */
@@ -836,6 +1115,20 @@ typedef struct {
     bool                                is_async;
     cyhal_event_callback_data_t         callback_data;
     bool                                dc_configured;
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+    cyhal_async_mode_t                  async_mode;
+    cyhal_dma_t                         dma_tx;
+    cyhal_dma_t                         dma_rx;
+    cyhal_dma_lli_t                     dma_tx_lli;
+    cyhal_dma_lli_t                     dma_rx_lli;
+    const uint8_t                       *dma_tx_buff;
+    uint8_t                             *dma_rx_buff;
+    volatile uint32_t                   dma_tx_length;
+    volatile uint32_t                   dma_rx_length;
+    volatile uint32_t                   dma_length;
+    uint32_t                            dma_fill;
+    uint32_t                            dma_sink;
+#endif
 } cyhal_spi_t;
 
 /**
@@ -878,6 +1171,20 @@ typedef _cyhal_audioss_t cyhal_tdm_t;
   */
 typedef _cyhal_audioss_configurator_t cyhal_tdm_configurator_t;
 
+/**
+  * @brief TDM fractional sample rate converter
+  *
+  * Application code should not rely on the specific contents of this struct.
+  * They are considered an implementation detail which is subject to change
+  * between platforms and/or HAL releases.
+  */
+typedef _cyhal_audioss_src_t cyhal_tdm_src_t;
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+/** TDM FIFO and interrupt statistics, see @ref cyhal_tdm_get_stats */
+typedef _cyhal_audioss_stats_t cyhal_tdm_stats_t;
+#endif
+
 /**
  * @brief T2Timer configurator struct
  *
@@ -908,7 +1215,7 @@ typedef struct
   * They are considered an implementation detail which is subject to change
   * between platforms and/or HAL releases.
   */
-typedef struct {
+typedef struct _cyhal_timer_s { /* Struct given an explicit name to make the forward declaration in cyhal_adc_t work */
     union
     {
       cyhal_tcpwm_t                     tcpwm;
@@ -934,6 +1241,51 @@ typedef struct
     const cyhal_clock_t *                   clock;
 } cyhal_timer_configurator_t;
 
+/** \cond INTERNAL */
+/** Maximum number of partially filled (flushed) chunks waiting to be consumed from the UART DMA receive ring */
+#define _CYHAL_UART_DMA_RING_MAX_SHORT  (4u)
+/** Number of linked list items used to send a long UART DMA write, or the buffers of a scatter/gather
+ * request, in one transfer */
+#define _CYHAL_UART_DMA_TX_LLI          (7u)
+
+/** A chunk of the UART DMA receive ring that was closed early by a flush */
+typedef struct
+{
+    uint16_t                            chunk;
+    uint16_t                            length;
+} _cyhal_uart_dma_ring_short_t;
+/** \endcond */
+
+/**
+  * @brief UART scatter/gather element
+  *
+  * Describes one buffer of a \ref cyhal_uart_writev_async request.
+  */
+typedef struct
+{
+    const void*                         buffer;     //!< Data to send, in units of the configured data width
+    size_t                              length;     //!< Number of data elements in buffer
+} cyhal_uart_iovec_t;
+
+/**
+  * @brief UART write request
+  *
+  * Caller allocated storage for one \ref cyhal_uart_writev_async request. It must remain valid
+  * until the completion callback of the request has been called.
+  *
+  * Application code should not rely on the specific contents of this struct.
+  * They are considered an implementation detail which is subject to change
+  * between platforms and/or HAL releases.
+  */
+typedef struct _cyhal_uart_tx_request_s { /* Explicit name to allow the self reference below */
+    const cyhal_uart_iovec_t*           iov;
+    size_t                              iov_count;
+    /* Element currently being sent */
+    size_t                              iov_index;
+    cyhal_event_callback_data_t         callback_data;
+    struct _cyhal_uart_tx_request_s*    next;
+} cyhal_uart_tx_request_t;
+
 /**
   * @brief UART object
   *
@@ -960,6 +1312,11 @@ typedef struct {
     cyhal_event_callback_data_t         callback_data;
     bool                                dc_configured;
     uint32_t                            baud_rate;
+    // Pending cyhal_uart_writev_async requests, sent in order
+    cyhal_uart_tx_request_t*            tx_queue_head;
+    cyhal_uart_tx_request_t*            tx_queue_tail;
+    // Set while an element of the request at the head of the queue is being sent
+    volatile bool                       tx_queue_busy;
 #if (CYHAL_DRIVER_AVAILABLE_DMA)
     cyhal_async_mode_t                  async_mode;
     cyhal_dma_t                         dma_tx;
@@ -969,6 +1326,22 @@ typedef struct {
     volatile void                       *async_tx_buff;
     volatile void                       *async_rx_buff;
     uint32_t                            user_fifo_level;
+    cyhal_dma_lli_t                     dma_tx_lli[_CYHAL_UART_DMA_TX_LLI];
+    // Continuous receive ring, see cyhal_uart_dma_ring_start
+    uint8_t                             *dma_ring;
+    uint32_t                            dma_ring_chunks;
+    uint32_t                            dma_ring_rd;
+    volatile uint32_t                   dma_ring_wr_chunk;
+    volatile uint32_t                   dma_ring_used;
+    volatile bool                       dma_ring_inflight;
+    volatile bool                       dma_ring_flush_pending;
+    volatile uint32_t                   dma_ring_completed;
+    cyhal_timer_t                       *dma_ring_timer;
+    uint32_t                            dma_ring_idle_count;
+    uint32_t                            dma_ring_idle_completed;
+    _cyhal_uart_dma_ring_short_t        dma_ring_short[_CYHAL_UART_DMA_RING_MAX_SHORT];
+    volatile uint8_t                    dma_ring_short_head;
+    volatile uint8_t                    dma_ring_short_count;
 #endif
 } cyhal_uart_t;
 
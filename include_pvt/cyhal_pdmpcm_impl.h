@@ -0,0 +1,142 @@
+/***************************************************************************//**
+* \file cyhal_pdmpcm_impl.h
+*
+* \brief
+* Implementation details of Infineon PDM/PCM.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "cyhal_pdmpcm.h"
+
+#if (CYHAL_DRIVER_AVAILABLE_PDMPCM)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \addtogroup group_hal_impl_pdmpcm
+ * \{
+ * \section section_hal_impl_pdmpcm_stream Streaming receive
+ * \ref cyhal_pdm_pcm_read_async only reads one hardware half buffer of
+ * \ref CYHAL_PDM_PCM_STREAM_BLOCK words at a time, so the application has to resubmit the read
+ * for every block before the next one is complete. In streaming mode, started with
+ * \ref cyhal_pdm_pcm_stream_start, the interrupt handler instead appends every block to an
+ * application ring buffer of any size, and notifies the application each time a frame of a
+ * chosen size has been received. The stream and \ref cyhal_pdm_pcm_read_async
+ * cannot be used at the same time. While streaming, \ref cyhal_pdm_pcm_is_pending returns
+ * true and \ref cyhal_pdm_pcm_abort_async stops the stream like \ref cyhal_pdm_pcm_stream_stop.
+ */
+
+/** Number of words the hardware delivers at a time */
+#define CYHAL_PDM_PCM_STREAM_BLOCK      (128u)
+
+/** Starts receiving continuously into a ring buffer.
+ *
+ * Every block of \ref CYHAL_PDM_PCM_STREAM_BLOCK words is read straight into the ring from the
+ * interrupt handler. The @ref CYHAL_PDM_PCM_ASYNC_COMPLETE event is raised each time at least
+ * threshold more words have been received, for example every 160 words for 10 ms frames at
+ * 16 kHz. Received data is read with \ref cyhal_pdm_pcm_stream_peek and released with
+ * \ref cyhal_pdm_pcm_stream_consume. If the ring has no room for a block, the block is dropped
+ * and @ref CYHAL_PDM_PCM_RX_OVERFLOW is raised. The words have the same format as for
+ * \ref cyhal_pdm_pcm_read_async.
+ *
+ * @param[in] obj       The PDM/PCM object. It must have been started with \ref cyhal_pdm_pcm_start.
+ * @param[in] ring      The ring buffer
+ * @param[in] size      The size of the ring in words. Must be at least
+ *                      \ref CYHAL_PDM_PCM_STREAM_BLOCK. Blocks are read straight into the
+ *                      ring when the size is a multiple of \ref CYHAL_PDM_PCM_STREAM_BLOCK,
+ *                      and copied in two parts across the wrap-around otherwise.
+ * @param[in] threshold The number of words between two notifications, from 1 to size
+ * @return The status of the start request
+ */
+cy_rslt_t cyhal_pdm_pcm_stream_start(cyhal_pdm_pcm_t *obj, uint32_t *ring, size_t size, size_t threshold);
+
+/** Stops the stream started by \ref cyhal_pdm_pcm_stream_start.
+ *
+ * Data that has not been consumed is discarded.
+ *
+ * @param[in] obj   The PDM/PCM object
+ * @return The status of the stop request
+ */
+cy_rslt_t cyhal_pdm_pcm_stream_stop(cyhal_pdm_pcm_t *obj);
+
+/** Returns the oldest received data that has not been consumed yet.
+ *
+ * The returned span is contiguous in memory; call this again after consuming it to get the
+ * data that follows a wrap-around.
+ *
+ * @param[in]  obj   The PDM/PCM object
+ * @param[out] data  Set to the consumer position in the ring
+ * @return The number of words available at data
+ */
+size_t cyhal_pdm_pcm_stream_peek(cyhal_pdm_pcm_t *obj, const uint32_t **data);
+
+/** Releases data returned by \ref cyhal_pdm_pcm_stream_peek back to the stream.
+ *
+ * @param[in] obj    The PDM/PCM object
+ * @param[in] length The number of words to release. Must not exceed the value returned by
+ *                   \ref cyhal_pdm_pcm_stream_peek.
+ */
+void cyhal_pdm_pcm_stream_consume(cyhal_pdm_pcm_t *obj, size_t length);
+
+/** Largest factor accepted by \ref cyhal_pdm_pcm_set_decimation */
+#define CYHAL_PDM_PCM_MAX_DECIMATION            (3u)
+
+/** DC blocker pole of 0.995 in Q15, a cut-off of about 13 Hz at 16 kHz */
+#define CYHAL_PDM_PCM_DC_BLOCKER_POLE_DEFAULT   (32604u)
+
+/** Enables a one-pole DC blocking filter on the received samples.
+ *
+ * The filter computes y[n] = x[n] - x[n-1] + pole * y[n-1] in the interrupt handler, before
+ * decimation and gain are applied.
+ *
+ * @param[in] obj   The PDM/PCM object
+ * @param[in] pole  The pole in Q15, for example \ref CYHAL_PDM_PCM_DC_BLOCKER_POLE_DEFAULT.
+ *                  0 disables the filter.
+ * @return The status of the request
+ */
+cy_rslt_t cyhal_pdm_pcm_set_dc_blocker(cyhal_pdm_pcm_t *obj, uint16_t pole);
+
+/** Reduces the output sample rate by low-pass filtering the received samples and keeping one
+ * in every factor.
+ *
+ * Decimation shortens each hardware block, so it is only available in streaming mode;
+ * \ref cyhal_pdm_pcm_read_async returns \ref CYHAL_PDM_PCM_RSLT_ERR_UNSUPPORTED while the
+ * factor is above 1. The filter is a 15-tap FIR (half-band for 2x, third-band for 3x) that is
+ * flat to within 0.1 dB (2x) or 0.7 dB (3x) up to half the new Nyquist frequency and attenuates
+ * aliases folding into that band by about 39 dB (2x) or 22 dB (3x).
+ *
+ * @param[in] obj     The PDM/PCM object. No read or stream may be in progress.
+ * @param[in] factor  1 (no decimation) to \ref CYHAL_PDM_PCM_MAX_DECIMATION
+ * @return The status of the request
+ */
+cy_rslt_t cyhal_pdm_pcm_set_decimation(cyhal_pdm_pcm_t *obj, uint8_t factor);
+
+/** \} group_hal_impl_pdmpcm */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* CYHAL_DRIVER_AVAILABLE_PDMPCM */
@@ -0,0 +1,84 @@
+/***************************************************************************//**
+* \file cyhal_qspi_impl.h
+*
+* \brief
+* Implementation details of Infineon QSPI.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "cyhal_qspi.h"
+
+#if (CYHAL_DRIVER_AVAILABLE_QSPI)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \addtogroup group_hal_impl_qspi
+ * \{
+ * \section section_hal_impl_qspi_xip Memory-mapped (XIP) reads
+ * \ref cyhal_qspi_enable_xip maps the memory on the active slave select into the CPU address
+ * space. Each access of the window makes the SMIF send the given read command with the accessed
+ * address, so the memory is read with plain loads, by the CPU or by DMA, and can be cached
+ * where the window lies in a cacheable region. The window is read-only. While it is enabled,
+ * command mode transfers such as \ref cyhal_qspi_read return
+ * \ref CYHAL_QSPI_RSLT_ERR_UNSUPPORTED; disable the window before erasing or programming
+ * the memory, and invalidate any cached copy of it afterwards.
+ */
+
+/** Enables memory-mapped (XIP) reads of the memory on the active slave select.
+ *
+ * @param[in] obj          The QSPI object
+ * @param[in] command      The read command used for every access of the window. The address phase
+ *                         must be enabled and mode bits, if used, must be 8 bits.
+ * @param[in] base_address Start of the window in the CPU address space. It must be inside the
+ *                         XIP region of the device and aligned to size.
+ * @param[in] size         Size of the window in bytes, a power of two
+ * @return The status of the enable request
+ */
+cy_rslt_t cyhal_qspi_enable_xip(cyhal_qspi_t *obj, const cyhal_qspi_command_t *command, uint32_t base_address, uint32_t size);
+
+/** Disables memory-mapped reads enabled by \ref cyhal_qspi_enable_xip and returns to command mode.
+ *
+ * The CPU must not access the window, or execute from it, while it is being disabled.
+ *
+ * @param[in] obj   The QSPI object
+ * @return The status of the disable request
+ */
+cy_rslt_t cyhal_qspi_disable_xip(cyhal_qspi_t *obj);
+
+/** Returns whether memory-mapped reads are enabled.
+ *
+ * @param[in] obj   The QSPI object
+ * @return Whether memory-mapped reads are enabled
+ */
+bool cyhal_qspi_is_xip_enabled(const cyhal_qspi_t *obj);
+
+/** \} group_hal_impl_qspi */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* CYHAL_DRIVER_AVAILABLE_QSPI */
@@ -0,0 +1,62 @@
+/***************************************************************************//**
+* \file cyhal_spi_impl.h
+*
+* \brief
+* Implementation details of Infineon SPI.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "cyhal_spi.h"
+
+#if (CYHAL_DRIVER_AVAILABLE_SPI)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+* \addtogroup group_hal_impl_spi
+* \{
+*/
+
+/** Set the mechanism that is used to perform SPI asynchronous transfers. The default is SW.
+ *
+ * DMA mode is only supported in master mode.
+ *
+ * @param[in]  obj          The SPI object
+ * @param[in]  mode         The transfer mode
+ * @param[in]  dma_priority The priority, if DMA is used. Valid values are the same as for
+ *                          @ref cyhal_dma_init. If DMA is not selected, the only valid value
+ *                          is CYHAL_DMA_PRIORITY_DEFAULT, and no guarantees are made about
+ *                          prioritization.
+ * @return The status of the set mode request
+ */
+cy_rslt_t cyhal_spi_set_async_mode(cyhal_spi_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority);
+
+/** \} group_hal_impl_spi */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* CYHAL_DRIVER_AVAILABLE_SPI */
@@ -78,6 +78,295 @@ extern "C" {
 #define cyhal_tdm_abort_read_async(obj) _cyhal_audioss_abort_read_async((_cyhal_audioss_t *)(obj))
 #define cyhal_tdm_abort_write_async(obj) _cyhal_audioss_abort_write_async((_cyhal_audioss_t *)(obj))
 
+/**
+* \addtogroup group_hal_impl_tdm
+* \{
+*/
+
+/** Starts transmit and receive together, so that both begin on the same frame.
+ *
+ * With separate calls to @ref cyhal_tdm_start_tx and @ref cyhal_tdm_start_rx, the offset between
+ * the two directions varies from run to run. This function clears the RX FIFO and then starts
+ * both directions back to back with interrupts disabled, so the first word received is from the
+ * same frame as the first word transmitted. Prefill the TX FIFO first, for example with
+ * @ref cyhal_tdm_write or @ref cyhal_tdm_write_async. Data read back then lags the data written by
+ * exactly the number of prefilled frames plus the delay of the external path. For this to hold,
+ * both directions must run from the same clock and frame sync, as in the usual case where both are
+ * masters with the same sample rate. On devices with the MXTDM block the two directions are
+ * started by two consecutive register writes, so in the rare case that a frame edge falls between
+ * them, transmit starts one frame after receive; @ref CYHAL_AUDIOSS_DUPLEX_MAX_SKEW_FRAMES is
+ * the largest such offset on the device. Applications that need exact alignment should calibrate
+ * the lag, for example with a known pattern, rather than assume it.
+ *
+ * @param[in]  obj         The TDM object. Both directions must be configured and stopped.
+ * @param[out] start_ticks Set to the value of CYHAL_AUDIOSS_TIMESTAMP_GET_TICKS() at the start.
+ * This defaults to the CPU cycle counter (DWT->CYCCNT) and may be defined by the application to
+ * read a different timer, such as the BT clock. May be NULL.
+ * @return The status of the request
+ */
+#define cyhal_tdm_start_duplex(obj, start_ticks) \
+    _cyhal_audioss_start_duplex((_cyhal_audioss_t *)(obj), (start_ticks))
+
+/** Starts a continuous DMA transmit over a ring buffer split into equally sized periods.
+ *
+ * The DMA streams the ring repeatedly without CPU intervention. The
+ * @ref CYHAL_TDM_ASYNC_TX_COMPLETE event is raised each time a period has been sent, starting
+ * from period 0 and wrapping around; the application refills that period while the DMA sends
+ * the others. The transfer runs until @ref cyhal_tdm_abort_write_async is called.
+ * The async mode must be @ref CYHAL_ASYNC_DMA.
+ *
+ * @param[in] obj           The TDM object
+ * @param[in] tx            The ring buffer, num_periods * period_length words long
+ * @param[in] period_length The number of words in each period
+ * @param[in] num_periods   The number of periods in the ring, from 2 to 4
+ * @return The status of the request
+ */
+#define cyhal_tdm_write_circular(obj, tx, period_length, num_periods) \
+    _cyhal_audioss_write_circular((_cyhal_audioss_t *)(obj), (tx), (period_length), (num_periods))
+
+/** Starts a continuous DMA receive into a ring buffer split into equally sized periods.
+ *
+ * The @ref CYHAL_TDM_ASYNC_RX_COMPLETE event is raised each time a period has been filled. The
+ * transfer runs until @ref cyhal_tdm_abort_read_async is called. See @ref cyhal_tdm_write_circular.
+ *
+ * @param[in] obj           The TDM object
+ * @param[in] rx            The ring buffer, num_periods * period_length words long
+ * @param[in] period_length The number of words in each period
+ * @param[in] num_periods   The number of periods in the ring, from 2 to 4
+ * @return The status of the request
+ */
+#define cyhal_tdm_read_circular(obj, rx, period_length, num_periods) \
+    _cyhal_audioss_read_circular((_cyhal_audioss_t *)(obj), (rx), (period_length), (num_periods))
+
+/** The buffer could not be queued because the queue is full or a circular transfer is running */
+#define CYHAL_TDM_RSLT_ERR_BUSY \
+    (CY_RSLT_CREATE_EX(CY_RSLT_TYPE_ERROR, CY_RSLT_MODULE_ABSTRACTION_HAL, CYHAL_RSLT_MODULE_TDM, 5))
+
+/** Queues a buffer to be transmitted once the pending async writes are done.
+ *
+ * If no async write is pending, this behaves like @ref cyhal_tdm_write_async. Otherwise the
+ * buffer is added to a queue of up to @ref CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH buffers, and the driver
+ * moves on to it from its interrupt handler as soon as the current buffer is done, so there is no
+ * gap while the application reacts. @ref CYHAL_TDM_ASYNC_TX_COMPLETE is raised once for every
+ * buffer, in submission order. @ref cyhal_tdm_abort_write_async also discards the queued buffers.
+ *
+ * @param[in] obj       The TDM object
+ * @param[in] tx        The buffer to send. It must remain valid until its completion event.
+ * @param[in] tx_length The number of words in the buffer
+ * @return The status of the request. @ref CYHAL_TDM_RSLT_ERR_BUSY is returned if the queue is full
+ * or a circular transmit is running.
+ */
+#define cyhal_tdm_queue_write_async(obj, tx, tx_length) \
+    _cyhal_audioss_queue_write_async((_cyhal_audioss_t *)(obj), (tx), (tx_length))
+
+/** Queues a buffer to be filled once the pending async reads are done.
+ *
+ * @ref CYHAL_TDM_ASYNC_RX_COMPLETE is raised once for every buffer, in submission order.
+ * See @ref cyhal_tdm_queue_write_async.
+ *
+ * @param[in] obj       The TDM object
+ * @param[in] rx        The buffer to fill. It must remain valid until its completion event.
+ * @param[in] rx_length The number of words in the buffer
+ * @return The status of the request
+ */
+#define cyhal_tdm_queue_read_async(obj, rx, rx_length) \
+    _cyhal_audioss_queue_read_async((_cyhal_audioss_t *)(obj), (rx), (rx_length))
+
+/** Starts an asynchronous read that stores the samples of each slot in a separate buffer.
+ *
+ * The received words are distributed round robin over the slot buffers, so that slot_buffers[i]
+ * receives every num_slots-th word starting with word i. The samples are moved straight from the
+ * FIFO into the slot buffers, so no deinterleaving pass is needed afterwards. A NULL entry drops
+ * the samples of that slot. The elements of the slot buffers have the same size as for
+ * @ref cyhal_tdm_read_async. @ref CYHAL_TDM_ASYNC_RX_COMPLETE is raised once all frames have been
+ * received. The async mode must be @ref CYHAL_ASYNC_SW, because the DMA can only write to
+ * consecutive addresses.
+ *
+ * @param[in] obj          The TDM object
+ * @param[in] slot_buffers Array of num_slots buffers, each frames elements long. The array and the
+ *                         buffers must remain valid until the read completes or is aborted.
+ * @param[in] num_slots    The number of words in each frame, which must equal the number of enabled
+ *                         RX channels
+ * @param[in] frames       The number of frames to receive
+ * @return The status of the request. @ref CYHAL_TDM_RSLT_ERR_BUSY if a read is already in progress.
+ */
+#define cyhal_tdm_read_demux_async(obj, slot_buffers, num_slots, frames) \
+    _cyhal_audioss_read_demux_async((_cyhal_audioss_t *)(obj), (slot_buffers), (num_slots), (frames))
+
+/** Starts measuring the actual sample rate of one direction against a reference timer.
+ *
+ * The driver counts the words it moves through the FIFO; together with the FIFO level this gives
+ * the number of frames that have crossed the serial interface. Call this with the current value
+ * of a free-running reference timer, for example a timer clocked from the BT clock, and later call
+ * @ref cyhal_tdm_get_measured_rate with a new timer value to get the rate over the window. Longer
+ * windows give more precise results. In DMA mode the count advances one DMA transfer or circular
+ * period at a time, so the timer values are best taken in the @ref CYHAL_TDM_ASYNC_TX_COMPLETE or
+ * @ref CYHAL_TDM_ASYNC_RX_COMPLETE callback. Clearing the FIFO invalidates the measurement.
+ *
+ * @param[in] obj       The TDM object
+ * @param[in] is_tx     True to measure the transmit direction, false for receive
+ * @param[in] ref_ticks The current value of the reference timer
+ * @return The status of the request
+ */
+#define cyhal_tdm_start_rate_measurement(obj, is_tx, ref_ticks) \
+    _cyhal_audioss_start_rate_measurement((_cyhal_audioss_t *)(obj), (is_tx), (ref_ticks))
+
+/** Returns the sample rate measured since @ref cyhal_tdm_start_rate_measurement.
+ *
+ * The measurement window keeps running, so this can be called repeatedly to refine the result.
+ * The difference to the nominal rate is the drift of the audio clock against the reference
+ * timer, which can be passed on to @ref cyhal_tdm_src_set_ratio.
+ *
+ * @param[in]  obj          The TDM object
+ * @param[in]  is_tx        True to measure the transmit direction, false for receive
+ * @param[in]  ref_ticks    The current value of the reference timer
+ * @param[in]  ref_hz       The frequency of the reference timer
+ * @param[out] rate_millihz The measured sample rate, in thousandths of a Hz
+ * @return The status of the request
+ */
+#define cyhal_tdm_get_measured_rate(obj, is_tx, ref_ticks, ref_hz, rate_millihz) \
+    _cyhal_audioss_get_measured_rate((_cyhal_audioss_t *)(obj), (is_tx), (ref_ticks), (ref_hz), (rate_millihz))
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+/** Reads the FIFO and interrupt statistics of the TDM object.
+ *
+ * The statistics are only kept when CYHAL_AUDIOSS_STATS_ENABLED is defined. Times are measured in
+ * ticks of CYHAL_AUDIOSS_STATS_GET_TICKS(), which defaults to the CPU cycle counter (DWT->CYCCNT)
+ * and may be defined by the application to use a different free-running counter.
+ * While an async transfer is in progress, the FIFO underflow and overflow interrupts are enabled so
+ * that they can be counted, and the FIFO level is sampled on entry to the interrupt handler. The
+ * minimum TX level and maximum RX level show how close the stream came to an underrun or overrun,
+ * and how much of the FIFO was used up by the interrupt latency, which helps in choosing the FIFO
+ * trigger levels and the DMA priority.
+ *
+ * @param[in]  obj   The TDM object
+ * @param[out] stats The statistics
+ * @return The status of the request
+ */
+#define cyhal_tdm_get_stats(obj, stats) \
+    _cyhal_audioss_get_stats((_cyhal_audioss_t *)(obj), (stats))
+
+/** Resets the statistics of the TDM object.
+ *
+ * @param[in]  obj   The TDM object
+ */
+#define cyhal_tdm_clear_stats(obj) _cyhal_audioss_clear_stats((_cyhal_audioss_t *)(obj))
+#endif /* defined(CYHAL_AUDIOSS_STATS_ENABLED) */
+
+/** Packs 24-bit samples held in 32-bit words into 3 bytes each, little endian.
+ *
+ * Samples read from or written to the FIFO with a word length of 24 bits occupy a 32-bit word
+ * each; packing them saves a quarter of the buffer memory.
+ *
+ * @param[out] dst   The packed samples, 3 * count bytes
+ * @param[in]  src   The samples, in the lower 24 bits of each word
+ * @param[in]  count The number of samples
+ */
+#define cyhal_tdm_pack_24(dst, src, count) _cyhal_audioss_pack_24((dst), (src), (count))
+
+/** Unpacks 24-bit samples produced by @ref cyhal_tdm_pack_24 into sign extended 32-bit words.
+ *
+ * @param[out] dst   The samples
+ * @param[in]  src   The packed samples, 3 * count bytes
+ * @param[in]  count The number of samples
+ */
+#define cyhal_tdm_unpack_24(dst, src, count) _cyhal_audioss_unpack_24((dst), (src), (count))
+
+/** Converts 16-bit samples to 32-bit samples, shifting each one left by shift bits.
+ *
+ * @param[out] dst   The 32-bit samples
+ * @param[in]  src   The 16-bit samples
+ * @param[in]  count The number of samples
+ * @param[in]  shift The number of bits to shift left by, from 0 to 16
+ */
+#define cyhal_tdm_convert_16_to_32(dst, src, count, shift) \
+    _cyhal_audioss_convert_16_to_32((dst), (src), (count), (shift))
+
+/** Converts 32-bit samples to 16-bit samples, shifting each one right by shift bits and
+ * saturating the result.
+ *
+ * @param[out] dst   The 16-bit samples
+ * @param[in]  src   The 32-bit samples
+ * @param[in]  count The number of samples
+ * @param[in]  shift The number of bits to shift right by, from 0 to 31
+ */
+#define cyhal_tdm_convert_32_to_16(dst, src, count, shift) \
+    _cyhal_audioss_convert_32_to_16((dst), (src), (count), (shift))
+
+/** Interleaves separate left and right 16-bit channels into stereo frames.
+ *
+ * @param[out] dst    The interleaved samples, 2 * frames long
+ * @param[in]  left   The left channel
+ * @param[in]  right  The right channel
+ * @param[in]  frames The number of frames
+ */
+#define cyhal_tdm_interleave_16(dst, left, right, frames) \
+    _cyhal_audioss_interleave_16((dst), (left), (right), (frames))
+
+/** Splits interleaved 16-bit stereo frames into separate left and right channels.
+ *
+ * @param[out] left   The left channel
+ * @param[out] right  The right channel
+ * @param[in]  src    The interleaved samples, 2 * frames long
+ * @param[in]  frames The number of frames
+ */
+#define cyhal_tdm_deinterleave_16(left, right, src, frames) \
+    _cyhal_audioss_deinterleave_16((left), (right), (src), (frames))
+
+/** 32-bit variant of @ref cyhal_tdm_interleave_16 */
+#define cyhal_tdm_interleave_32(dst, left, right, frames) \
+    _cyhal_audioss_interleave_32((dst), (left), (right), (frames))
+
+/** 32-bit variant of @ref cyhal_tdm_deinterleave_16 */
+#define cyhal_tdm_deinterleave_32(left, right, src, frames) \
+    _cyhal_audioss_deinterleave_32((left), (right), (src), (frames))
+
+/** Initializes a fractional sample rate converter with a ratio of 1.
+ *
+ * The converter resamples interleaved frames by linear interpolation. It is meant to absorb the
+ * small drift between the rate at which audio is produced, for example by a BT link, and the
+ * rate at which the TDM interface consumes it, without dropping or repeating samples.
+ *
+ * @param[out] src          The converter state
+ * @param[in]  num_channels The number of channels in each frame, up to
+ *                          @ref CYHAL_AUDIOSS_SRC_MAX_CHANNELS
+ */
+#define cyhal_tdm_src_init(src, num_channels) _cyhal_audioss_src_init((src), (num_channels))
+
+/** Sets the conversion ratio of a sample rate converter.
+ *
+ * The ratio can be updated at any time, for example from the result of
+ * @ref cyhal_tdm_get_measured_rate; the output stays continuous. Ratios are limited to
+ * the range 1/2 to 2.
+ *
+ * @param[in] src              The converter state
+ * @param[in] in_rate_millihz  The input sample rate, in thousandths of a Hz
+ * @param[in] out_rate_millihz The output sample rate, in thousandths of a Hz
+ */
+#define cyhal_tdm_src_set_ratio(src, in_rate_millihz, out_rate_millihz) \
+    _cyhal_audioss_src_set_ratio((src), (in_rate_millihz), (out_rate_millihz))
+
+/** Converts 16-bit interleaved frames.
+ *
+ * Stops when either dst is full or the input has been used up. Input frames that have not been
+ * consumed must be passed in again on the next call.
+ *
+ * @param[in]     src        The converter state
+ * @param[out]    dst        The output frames
+ * @param[in]     dst_frames The number of frames that fit in dst
+ * @param[in]     in         The input frames
+ * @param[in,out] in_frames  The number of input frames; updated to the number consumed
+ * @return The number of frames written to dst
+ */
+#define cyhal_tdm_src_process_16(src, dst, dst_frames, in, in_frames) \
+    _cyhal_audioss_src_process_16((src), (dst), (dst_frames), (in), (in_frames))
+
+/** 32-bit variant of @ref cyhal_tdm_src_process_16 */
+#define cyhal_tdm_src_process_32(src, dst, dst_frames, in, in_frames) \
+    _cyhal_audioss_src_process_32((src), (dst), (dst_frames), (in), (in_frames))
+
+/** \} group_hal_impl_tdm */
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
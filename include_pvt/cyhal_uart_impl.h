@@ -0,0 +1,169 @@
+/***************************************************************************//**
+* \file cyhal_uart_impl.h
+*
+* \brief
+* Implementation details of Infineon UART.
+*
+********************************************************************************
+* \copyright
+* Copyright 2024 Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "cyhal_uart.h"
+
+#if (CYHAL_DRIVER_AVAILABLE_UART)
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \addtogroup group_hal_impl_uart UART (Universal Asynchronous Receiver-Transmitter)
+ * \ingroup group_hal_impl
+ * \{
+ * \section section_hal_impl_uart_dma_ring DMA receive ring
+ * In DMA mode the receiver can run continuously into an application ring buffer, see
+ * \ref cyhal_uart_dma_ring_start. The DMA moves data in chunks of \ref CYHAL_UART_DMA_RING_CHUNK
+ * bytes, so no byte is lost between reads and the CPU is only interrupted once per chunk.
+ * The receive ring and \ref cyhal_uart_read_async cannot be used at the same time.
+ * The DMA receive channel is shared with every SCB block. Each chunk is a separate single-burst
+ * transfer that is only started once the whole chunk is in the RX FIFO, so the ring holds the
+ * channel only while a burst runs and the RX DMA of other UARTs and SPIs can use it in between.
+ * The RX FIFO trigger is used by the ring while it runs, so the @ref CYHAL_UART_IRQ_RX_FIFO event
+ * is not raised and the RX FIFO level must not be changed until the ring is stopped.
+ *
+ * \section section_hal_impl_uart_writev Scatter/gather writes
+ * \ref cyhal_uart_writev_async sends a list of buffers, for example a header, a payload and a CRC,
+ * without copying them into one buffer first. Requests are queued and sent in order, so a new
+ * request can be submitted while the previous one is still being sent. In DMA mode the buffers of
+ * a request are chained into a single DMA transfer of up to 8 segments, so a request costs one
+ * completion interrupt, and the next request is started from it while the TX FIFO still holds
+ * data, so the line stays busy between requests. In SW mode the next buffer is started once the
+ * previous one has been fully transmitted.
+ * \ref cyhal_uart_write_async cannot be used while requests are queued.
+ */
+
+/** Queues an asynchronous write of a list of buffers.
+ *
+ * The buffers are sent back to back in the order given. The request is appended to the queue
+ * of pending requests and this function returns immediately.
+ *
+ * @param[in]  obj          The UART object
+ * @param[out] req          Caller allocated storage for the request. It must remain valid until
+ * \p callback is called.
+ * @param[in]  iov          Array of \p count buffers. The array and the buffers must remain valid
+ * until \p callback is called.
+ * @param[in]  count        Number of buffers in \p iov
+ * @param[in]  callback     Called with @ref CYHAL_UART_IRQ_TX_TRANSMIT_IN_FIFO once the last buffer
+ * of the request has been handed to the hardware, or with @ref CYHAL_UART_IRQ_TX_ERROR if the request
+ * failed or was aborted by \ref cyhal_uart_write_abort. May be NULL.
+ * @param[in]  callback_arg Argument passed to \p callback
+ * @return The status of the request. If an error is returned, \p callback will not be called.
+ */
+cy_rslt_t cyhal_uart_writev_async(cyhal_uart_t *obj, cyhal_uart_tx_request_t *req, const cyhal_uart_iovec_t *iov,
+                                  size_t count, cyhal_uart_event_callback_t callback, void *callback_arg);
+
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+
+#if !defined(CYHAL_UART_DMA_RING_CHUNK)
+/** Number of bytes moved by each DMA burst of the receive ring. The ring size must be a multiple
+ * of this value. It must be a supported DMA burst size no larger than half of the HW RX FIFO. */
+#define CYHAL_UART_DMA_RING_CHUNK       (CY_SCB_FIFO_SIZE / 2u)
+#endif
+
+/** Starts receiving continuously into a ring buffer using DMA.
+ *
+ * The driver keeps moving received data into the ring without being re-armed between reads.
+ * Received data is read with \ref cyhal_uart_dma_ring_peek and released with
+ * \ref cyhal_uart_dma_ring_consume. The @ref CYHAL_UART_IRQ_RX_DONE event is raised each time a
+ * chunk has been written. If the ring fills up, reception stops at a chunk boundary,
+ * @ref CYHAL_UART_IRQ_RX_FULL is raised, and further data is held in the HW FIFO (and by RTS flow
+ * control, if enabled) until data has been consumed.
+ * The async mode must be @ref CYHAL_ASYNC_DMA and the data width must not exceed 8 bits.
+ *
+ * If \p idle_timer is provided, it must have been initialized and configured by the application as
+ * a continuous timer whose period is a few character times. This function registers the ring
+ * callback on the timer, enables its terminal count event and starts it. When the RX FIFO holds a
+ * tail shorter than a chunk and neither the FIFO nor the ring has changed for a whole period, the
+ * tail is flushed into the ring as by \ref cyhal_uart_dma_ring_flush and
+ * @ref CYHAL_UART_IRQ_RX_DONE is raised.
+ *
+ * @param[in] obj        The UART object
+ * @param[in] ring       The ring buffer
+ * @param[in] size       The size of the ring in bytes. Must be a multiple of
+ *                       \ref CYHAL_UART_DMA_RING_CHUNK and at least 2 chunks long.
+ * @param[in] idle_timer The timer that detects an idle RX line, or NULL to only flush through
+ *                       \ref cyhal_uart_dma_ring_flush. It must remain valid until
+ *                       \ref cyhal_uart_dma_ring_stop is called.
+ * @return The status of the start request
+ */
+cy_rslt_t cyhal_uart_dma_ring_start(cyhal_uart_t *obj, uint8_t *ring, size_t size, cyhal_timer_t *idle_timer);
+
+/** Stops the DMA receive ring started by \ref cyhal_uart_dma_ring_start and stops its idle timer.
+ *
+ * Data that has not been consumed is discarded.
+ *
+ * @param[in] obj   The UART object
+ * @return The status of the stop request
+ */
+cy_rslt_t cyhal_uart_dma_ring_stop(cyhal_uart_t *obj);
+
+/** Returns the oldest received data that has not been consumed yet.
+ *
+ * The returned span is contiguous in memory; call this again after consuming it to get the
+ * data that follows a wrap-around or a flushed chunk.
+ *
+ * @param[in]  obj   The UART object
+ * @param[out] data  Set to the consumer position in the ring
+ * @return The number of bytes available at data
+ */
+size_t cyhal_uart_dma_ring_peek(cyhal_uart_t *obj, const uint8_t **data);
+
+/** Releases data returned by \ref cyhal_uart_dma_ring_peek back to the DMA.
+ *
+ * @param[in] obj    The UART object
+ * @param[in] length The number of bytes to release. Must not exceed the value returned by
+ *                   \ref cyhal_uart_dma_ring_peek.
+ */
+void cyhal_uart_dma_ring_consume(cyhal_uart_t *obj, size_t length);
+
+/** Flushes a partially received chunk into the ring.
+ *
+ * The DMA only moves whole chunks, so the tail of a message shorter than
+ * \ref CYHAL_UART_DMA_RING_CHUNK stays in the HW FIFO. This function moves it into the ring as a
+ * short chunk. If a chunk is still being moved by the DMA, the tail is moved from its completion
+ * interrupt instead, once the DMA no longer reads the FIFO. It is intended to be called once the
+ * RX line has been idle for a few character times; see the \p idle_timer argument of
+ * \ref cyhal_uart_dma_ring_start. The tail is left in the FIFO if the ring is full.
+ *
+ * @param[in] obj   The UART object
+ * @return The status of the flush request
+ */
+cy_rslt_t cyhal_uart_dma_ring_flush(cyhal_uart_t *obj);
+
+#endif /* CYHAL_DRIVER_AVAILABLE_DMA */
+
+/** \} group_hal_impl_uart */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* CYHAL_DRIVER_AVAILABLE_UART */
@@ -39,6 +39,10 @@
 #include "cyhal_clock.h"
 #include "cy_scb.h"
 
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+#include "cyabs_rtos.h"
+#endif
+
 typedef int32_t  _cyhal_system_irq_t;
 #define IRQn_Type _cyhal_system_irq_t
 
@@ -162,6 +166,42 @@ static inline cy_rslt_t _cyhal_utils_peri_pclk_disable_divider(en_clk_dst_t clk_
     return CY_RSLT_SUCCESS;
 }
 
+/* Completion objects (_cyhal_utils_wait_t) let blocking driver calls wait for their completion
+ * interrupt. With an RTOS (CY_RTOS_AWARE) a calling thread blocks on the object's semaphore, so
+ * other threads can run until the interrupt completes the operation. The semaphore is created by
+ * the first blocking call and kept until the driver object is freed. Calls made from an interrupt
+ * or before the scheduler has started cannot block and wait like on bare metal: the caller sleeps
+ * in WFI between interrupts when the SysTick interrupt is running, which bounds the time between
+ * timeout checks, and otherwise polls. */
+
+/** Prepares a completion object for one operation. It must be published to the interrupt handler
+ * after this call and before the operation is started, so a completion cannot be missed.
+ *
+ * @param[in,out] wait The completion object. It must have been zeroed when its driver object was
+ * initialized.
+ */
+void _cyhal_utils_wait_arm(_cyhal_utils_wait_t *wait);
+
+/** Waits until \ref _cyhal_utils_wait_signal is called or the timeout expires.
+ *
+ * @param[in] wait       The completion object
+ * @param[in] timeout_us The maximum time to wait, in microseconds
+ * @return Whether the object was signalled
+ */
+bool _cyhal_utils_wait_for(_cyhal_utils_wait_t *wait, uint32_t timeout_us);
+
+/** Signals a completion object. May be called from an interrupt handler.
+ *
+ * @param[in] wait The completion object, or NULL if nobody is waiting
+ */
+void _cyhal_utils_wait_signal(_cyhal_utils_wait_t *wait);
+
+/** Releases the resources of a completion object when its driver object is freed. It must not be
+ * published to the interrupt handler.
+ *
+ * @param[in] wait The completion object
+ */
+void _cyhal_utils_wait_free(_cyhal_utils_wait_t *wait);
 
 #if defined(__cplusplus)
 }
@@ -41,14 +41,14 @@
  * * VREF: @ref CYHAL_ADC_REF_INTERNAL (0.5V) only
  * * Single ended vneg: @ref CYHAL_ADC_VNEG_VSSA
  * * Programmable gains of 8/8, 8/7, 8/4, 8/1
+ * * Oversampling of up to 256 conversions per result, see \ref section_hal_impl_adcmic_averaging
  * * DC measurement through 8 pins
  * * ADC Mic audio through MIC_P pin to the PDM-PCM
  *
  * The following functions are not supported:
  * * Differential channels
- * * Continuous scanning
- * * Averaging. In @ref cyhal_adc_config_t, average count must be 1 and average_mode_flags must be 0.
- *   In @ref cyhal_adc_channel_config_t, enable_averaging must be false.
+ * * Continuous scanning through @ref cyhal_adc_config_t. Use \ref cyhal_adc_continuous_start to
+ *   scan at a rate set by a timer instead.
  * * External vref and bypass pins
  * 
  * There are 8 power gain amplifier (PGA) levels in the hardware. These are truncated to the 3 levels
@@ -61,6 +61,8 @@
 #include "cyhal_gpio.h"
 #include "cyhal_hwmgr.h"
 #include "cyhal_system.h"
+#include "cyhal_timer.h"
+#include "cyhal_utils.h"
 #include "cyhal_analog_common.h"
 #include <string.h>
 
@@ -74,6 +76,8 @@ extern "C"
 
 #define _CYHAL_ADCMIC_DEFAULT_READ              (0xADC0)
 #define _CYHAL_ADCMIC_DC_CALIBRATION_GAIN       (0x8000) /* Amount of raw counts per 1 volt of input voltage */
+#define _CYHAL_ADCMIC_READ_TIMEOUT_US           (1000u)
+#define _CYHAL_ADCMIC_CALIBRATION_MAGIC         (0xADCCA101UL) /* Change when the record format changes */
 #define _CYHAL_ADCMIC_NUM_CHANNELS(obj)         (sizeof(obj->channel_config) / sizeof(obj->channel_config[0]))
 
 static const uint8_t  _CYHAL_ADCMIC_RESOLUTION          = 15u;
@@ -137,6 +141,199 @@ static cy_en_adccomp_adc_dc_channel_t _cyhal_adcmic_convert_channel_sel(uint8_t
 }
 
 
+static uint8_t _cyhal_adcmic_count_enabled_channels(const cyhal_adc_t* obj)
+{
+    uint8_t count = 0u;
+    for (uint8_t i = 0u; i < _CYHAL_ADCMIC_NUM_CHANNELS(obj); i++)
+    {
+        if ((NULL != obj->channel_config[i]) && obj->channel_config[i]->enabled)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void _cyhal_adcmic_start_conversion(cyhal_adc_t* obj)
+{
+    Cy_ADCCOMP_ClearInterrupt(obj->base, CY_ADCCOMP_INTR_CIC);
+    Cy_ADCCOMP_ADC_SelectDcChannel(obj->base, obj->channel_config[obj->current_channel_index]->channel_sel);
+    Cy_ADCCOMP_ADC_Start(obj->base);
+    Cy_ADCCOMP_EnableInterrupt(obj->base, CY_ADCCOMP_INTR_CIC);
+}
+
+/*******************************************************************************
+*       Oversampling
+*******************************************************************************/
+
+static inline bool _cyhal_adcmic_is_averaging(const cyhal_adc_t* obj, const cyhal_adc_channel_t* channel)
+{
+    return (NULL != channel) && channel->enable_averaging && (obj->average_count > 1u);
+}
+
+/* Divides, rounding to nearest */
+static inline int32_t _cyhal_adcmic_div_round(int64_t value, int32_t divisor)
+{
+    return (int32_t)((value >= 0) ? ((value + (divisor / 2)) / divisor) : ((value - (divisor / 2)) / divisor));
+}
+
+/* Accumulates the conversion that just completed for the current channel. Returns false if more
+ * conversions of the same channel are needed, in which case the next one has been started. */
+static bool _cyhal_adcmic_oversample(cyhal_adc_t* obj)
+{
+    cyhal_adc_channel_t* channel = obj->channel_config[obj->current_channel_index];
+    int32_t sample = Cy_ADCCOMP_GetDcResult(obj->base);
+    bool done = true;
+
+    if (!_cyhal_adcmic_is_averaging(obj, channel))
+    {
+        obj->result_sum = sample;
+        obj->result_q8 = sample * 256;
+    }
+    else
+    {
+        if (0u != (obj->average_mode_flags & CYHAL_ADC_AVG_MODE_EXPONENTIAL))
+        {
+            if (!channel->filter_valid)
+            {
+                channel->filter_q8 = sample * 256;
+                channel->filter_valid = true;
+            }
+            else
+            {
+                channel->filter_q8 += ((sample * 256) - channel->filter_q8) / (int32_t)obj->average_count;
+            }
+        }
+        obj->avg_acc += sample;
+
+        if (++obj->avg_index < obj->average_count)
+        {
+            Cy_ADCCOMP_ADC_Stop(obj->base);
+            _cyhal_adcmic_start_conversion(obj);
+            done = false;
+        }
+        else
+        {
+            obj->result_sum = obj->avg_acc;
+            obj->result_q8 = (0u != (obj->average_mode_flags & CYHAL_ADC_AVG_MODE_EXPONENTIAL))
+                ? channel->filter_q8
+                : _cyhal_adcmic_div_round((int64_t)obj->avg_acc * 256, (int32_t)obj->average_count);
+            obj->avg_acc = 0;
+            obj->avg_index = 0u;
+        }
+    }
+
+    return done;
+}
+
+/* Returns the last result in counts: the sum in accumulate mode, the rounded average otherwise */
+static int32_t _cyhal_adcmic_result_counts(const cyhal_adc_t* obj, const cyhal_adc_channel_t* channel)
+{
+    return (_cyhal_adcmic_is_averaging(obj, channel) && (0u != (obj->average_mode_flags & CYHAL_ADC_AVG_MODE_ACCUMULATE)))
+        ? obj->result_sum
+        : _cyhal_adcmic_div_round(obj->result_q8, 256);
+}
+
+/* Returns the last result in microvolts, interpolating the fractional counts of an average */
+static int32_t _cyhal_adcmic_result_uv(const cyhal_adc_t* obj, const cyhal_adc_channel_t* channel)
+{
+    int32_t counts = (obj->result_q8 >= 0) ? (obj->result_q8 / 256) : -((255 - obj->result_q8) / 256); /* floor */
+    int32_t frac = obj->result_q8 - (counts * 256);
+    int32_t uv = Cy_ADCCOMP_CountsTo_uVolts((int16_t)counts, &obj->pdl_context);
+
+    if ((0 != frac) && (counts < INT16_MAX))
+    {
+        int32_t uv_next = Cy_ADCCOMP_CountsTo_uVolts((int16_t)(counts + 1), &obj->pdl_context);
+        uv += _cyhal_adcmic_div_round((int64_t)(uv_next - uv) * frac, 256);
+    }
+
+    if (_cyhal_adcmic_is_averaging(obj, channel) && (0u != (obj->average_mode_flags & CYHAL_ADC_AVG_MODE_ACCUMULATE)))
+    {
+        uv *= (int32_t)obj->average_count;
+    }
+
+    return uv;
+}
+
+static void _cyhal_adcmic_reset_filters(cyhal_adc_t* obj)
+{
+    for (uint8_t i = 0u; i < _CYHAL_ADCMIC_NUM_CHANNELS(obj); i++)
+    {
+        if (NULL != obj->channel_config[i])
+        {
+            obj->channel_config[i]->filter_valid = false;
+        }
+    }
+    obj->avg_acc = 0;
+    obj->avg_index = 0u;
+}
+
+/* Stores one continuous acquisition result and starts the next channel of the scan, if any */
+static void _cyhal_adcmic_continuous_store(cyhal_adc_t* obj)
+{
+    const cyhal_adc_channel_t* channel = obj->channel_config[obj->current_channel_index];
+    // The ring size is a multiple of the scan size, so a scan never wraps around
+    obj->cont_ring[obj->cont_head + obj->cont_scan_pos] = obj->cont_in_uv
+        ? _cyhal_adcmic_result_uv(obj, channel)
+        : _cyhal_adcmic_result_counts(obj, channel);
+    obj->cont_scan_pos++;
+
+    Cy_ADCCOMP_ADC_Stop(obj->base);
+
+    if (obj->cont_scan_pos < obj->cont_scan_size)
+    {
+        obj->current_channel_index = (obj->current_channel_index + 1) % _CYHAL_ADCMIC_NUM_CHANNELS(obj);
+        _cyhal_adcmic_find_next_channel(obj, &(obj->current_channel_index));
+        _cyhal_adcmic_start_conversion(obj);
+    }
+    else
+    {
+        // Publish the whole scan at once so that peek never returns a partial scan
+        size_t previous = obj->cont_count;
+        obj->cont_head = (obj->cont_head + obj->cont_scan_size) % obj->cont_size;
+        obj->cont_count = previous + obj->cont_scan_size;
+        obj->cont_scan_active = false;
+
+        if ((previous < obj->cont_watermark) && (obj->cont_count >= obj->cont_watermark)
+            && (0 != (CYHAL_ADC_ASYNC_READ_COMPLETE & ((cyhal_adc_event_t)obj->user_enabled_events))))
+        {
+            cyhal_adc_event_callback_t callback = (cyhal_adc_event_callback_t)obj->callback_data.callback;
+            if(NULL != callback)
+            {
+                callback(obj->callback_data.callback_arg, CYHAL_ADC_ASYNC_READ_COMPLETE);
+            }
+        }
+    }
+}
+
+/* Timer terminal count: start the next continuous acquisition scan */
+static void _cyhal_adcmic_timer_cb(void *callback_arg, cyhal_timer_event_t event)
+{
+    CY_UNUSED_PARAMETER(event);
+    cyhal_adc_t* obj = (cyhal_adc_t*)callback_arg;
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (NULL != obj->cont_ring)
+    {
+        if (obj->cont_scan_active || ((obj->cont_size - obj->cont_count) < obj->cont_scan_size))
+        {
+            obj->cont_skipped_scans++;
+        }
+        else
+        {
+            obj->cont_scan_active = true;
+            obj->cont_scan_pos = 0u;
+            obj->avg_acc = 0;
+            obj->avg_index = 0u;
+            obj->current_channel_index = 0u;
+            _cyhal_adcmic_find_next_channel(obj, &(obj->current_channel_index));
+            _cyhal_adcmic_start_conversion(obj);
+        }
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+
+
 /*******************************************************************************
 *       ADC callbacks used in _cyhal_adccomp_cb()
 *******************************************************************************/
@@ -165,7 +362,17 @@ void _cyhal_adcmic_calibrate(void)
         else
         {
             // Only perform DC calibration if using DC measurement
-            if (!obj->dc_calibrated)
+            if (obj->calib_restored)
+            {
+                // The stored offset is applied once the ADC is ready; no calibration conversion is needed
+                Cy_ADCCOMP_SetDcOffset(obj->base, obj->calibOffset, &obj->pdl_context);
+                Cy_ADCCOMP_SetDcGain(_CYHAL_ADCMIC_DC_CALIBRATION_GAIN, &obj->pdl_context);
+                Cy_ADCCOMP_DisableTimer(obj->base);
+                Cy_ADCCOMP_DisableInterrupt(obj->base, CY_ADCCOMP_INTR_ADC_READY);
+                obj->calib_restored = false;
+                obj->dc_calibrated = true;
+            }
+            else if (!obj->dc_calibrated)
             {
                 if (!obj->dc_calibration_started)
                 {
@@ -207,9 +414,11 @@ void _cyhal_adcmic_get_result(void)
         }
         else
         {
-            if (!obj->using_audio)
+            // An oversampled channel only completes after its last conversion
+            if (!obj->using_audio && _cyhal_adcmic_oversample(obj))
             {
                 obj->conversion_complete = true; // Used only for non-async reads
+                _cyhal_utils_wait_signal(obj->waiter);
 
                 Cy_ADCCOMP_DisableInterrupt(obj->base, CY_ADCCOMP_INTR_CIC);
 
@@ -222,17 +431,21 @@ void _cyhal_adcmic_get_result(void)
                     }
                 }
 
-                if(obj->async_scans_remaining > 0)
+                if (obj->cont_scan_active)
+                {
+                    _cyhal_adcmic_continuous_store(obj);
+                }
+                else if(obj->async_scans_remaining > 0)
                 {
-                    int16_t dc_data = Cy_ADCCOMP_GetDcResult(obj->base);
+                    const cyhal_adc_channel_t* channel = obj->channel_config[obj->current_channel_index];
 
                     if (obj->async_transfer_in_uv)
                     {
-                        *(obj->async_buff_next) = Cy_ADCCOMP_CountsTo_uVolts(dc_data, &obj->pdl_context);
+                        *(obj->async_buff_next) = _cyhal_adcmic_result_uv(obj, channel);
                     }
                     else
                     {
-                        *(obj->async_buff_next) = (int32_t)dc_data;
+                        *(obj->async_buff_next) = _cyhal_adcmic_result_counts(obj, channel);
                     }
 
                     Cy_ADCCOMP_ADC_Stop(obj->base);
@@ -278,7 +491,18 @@ void _cyhal_adcmic_get_result(void)
 *       ADC HAL Functions
 *******************************************************************************/
 
-cy_rslt_t _cyhal_adc_config_hw(cyhal_adc_t *obj, const cyhal_adc_configurator_t* cfg, cyhal_gpio_t pin, bool owned_by_configurator)
+static uint32_t _cyhal_adcmic_calibration_check(const cyhal_adc_calibration_t *cal)
+{
+    uint32_t check = cal->magic;
+    check = (check << 5) + check + (uint16_t)cal->offset;
+    check = (check << 5) + check + cal->gain;
+    check = (check << 5) + check + (uint16_t)cal->temperature;
+    check = (check << 5) + check + cal->reserved;
+    return ~check;
+}
+
+cy_rslt_t _cyhal_adc_config_hw(cyhal_adc_t *obj, const cyhal_adc_configurator_t* cfg, cyhal_gpio_t pin, bool owned_by_configurator,
+                               int16_t calib_offset, bool calib_restored)
 {
     CY_ASSERT(NULL != obj);
 
@@ -288,6 +512,8 @@ cy_rslt_t _cyhal_adc_config_hw(cyhal_adc_t *obj, const cyhal_adc_configurator_t*
     obj->resource.type = CYHAL_RSC_INVALID;
 
     obj->owned_by_configurator = owned_by_configurator;
+    obj->calibOffset = calib_offset;
+    obj->calib_restored = calib_restored;
     cy_en_adccomp_adc_mode_t adcMode = CY_ADCCOMP_ADC_DC;
 
     if(NULL == cfg->resource && NC != pin)
@@ -372,7 +598,8 @@ cy_rslt_t _cyhal_adc_config_hw(cyhal_adc_t *obj, const cyhal_adc_configurator_t*
     return result;
 }
 
-cy_rslt_t cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+/* Shared by cyhal_adc_init() and cyhal_adc_init_calibrated() */
+static cy_rslt_t _cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk, int16_t calib_offset, bool calib_restored)
 {
     cyhal_adc_configurator_t config;
     config.resource = NULL;
@@ -389,10 +616,58 @@ cy_rslt_t cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t
     config.clock = clk;
     config.num_channels = 0u;
 
-    cy_rslt_t result = _cyhal_adc_config_hw(obj, &config, pin, false);
+    cy_rslt_t result = _cyhal_adc_config_hw(obj, &config, pin, false, calib_offset, calib_restored);
     return result;
 }
 
+cy_rslt_t cyhal_adc_init(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk)
+{
+    return _cyhal_adc_init(obj, pin, clk, 0, false);
+}
+
+cy_rslt_t cyhal_adc_init_calibrated(cyhal_adc_t *obj, cyhal_gpio_t pin, const cyhal_clock_t *clk,
+                                    const cyhal_adc_calibration_t *cal, int16_t temperature,
+                                    uint16_t max_temperature_delta)
+{
+    bool usable = false;
+    if (NULL != cal)
+    {
+        int32_t delta = (int32_t)temperature - (int32_t)cal->temperature;
+        usable = (_CYHAL_ADCMIC_CALIBRATION_MAGIC == cal->magic)
+            && (_cyhal_adcmic_calibration_check(cal) == cal->check)
+            && (_CYHAL_ADCMIC_DC_CALIBRATION_GAIN == cal->gain)
+            && ((uint32_t)((delta < 0) ? -delta : delta) <= max_temperature_delta);
+    }
+
+    // An unusable record is not an error; the ADC is then calibrated as usual
+    return _cyhal_adc_init(obj, pin, clk, usable ? cal->offset : 0, usable);
+}
+
+cy_rslt_t cyhal_adc_get_calibration(const cyhal_adc_t *obj, int16_t temperature, cyhal_adc_calibration_t *cal)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != cal);
+
+    if (!obj->dc_calibrated)
+    {
+        return CYHAL_ADC_RSLT_ERR_BUSY;
+    }
+
+    cal->magic = _CYHAL_ADCMIC_CALIBRATION_MAGIC;
+    cal->offset = obj->calibOffset;
+    cal->gain = _CYHAL_ADCMIC_DC_CALIBRATION_GAIN;
+    cal->temperature = temperature;
+    cal->reserved = 0u;
+    cal->check = _cyhal_adcmic_calibration_check(cal);
+    return CY_RSLT_SUCCESS;
+}
+
+bool cyhal_adc_is_calibrated(const cyhal_adc_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->dc_calibrated;
+}
+
 cy_rslt_t cyhal_adc_init_cfg(cyhal_adc_t *adc, cyhal_adc_channel_t** channels, uint8_t* num_channels,
                                 const cyhal_adc_configurator_t *cfg)
 {
@@ -405,7 +680,7 @@ cy_rslt_t cyhal_adc_init_cfg(cyhal_adc_t *adc, cyhal_adc_channel_t** channels, u
     if(CY_RSLT_SUCCESS == result)
     {
         *num_channels = cfg->num_channels;
-        result = _cyhal_adc_config_hw(adc, cfg, NC, true);
+        result = _cyhal_adc_config_hw(adc, cfg, NC, true, 0, false);
     }
 
     if(CY_RSLT_SUCCESS == result)
@@ -432,6 +707,11 @@ void cyhal_adc_free(cyhal_adc_t *obj)
     CY_ASSERT(NULL != obj);
     if (CYHAL_RSC_INVALID != obj->resource.type)
     {
+        if (NULL != obj->cont_ring)
+        {
+            (void)cyhal_adc_continuous_stop(obj);
+        }
+
         if (NULL != obj->base)
         {
             Cy_ADCCOMP_DisableTimer(obj->base);
@@ -443,6 +723,7 @@ void cyhal_adc_free(cyhal_adc_t *obj)
         }
 
         _cyhal_adcmic_config_structs[obj->resource.block_num] = NULL;
+        _cyhal_utils_wait_free(&obj->wait);
 
         if(false == obj->owned_by_configurator)
         {
@@ -453,12 +734,18 @@ void cyhal_adc_free(cyhal_adc_t *obj)
 
 cy_rslt_t cyhal_adc_configure(cyhal_adc_t *obj, const cyhal_adc_config_t *config)
 {
-    /* The hardware is very limited, so all we can do is check that the config matches what we support */
-    CY_UNUSED_PARAMETER(obj);
+    /* The hardware is very limited, so apart from averaging, which is done in firmware,
+    * all we can do is check that the config matches what we support */
+    const uint32_t supported_flags = CYHAL_ADC_AVG_MODE_AVERAGE | CYHAL_ADC_AVG_MODE_ACCUMULATE | CYHAL_ADC_AVG_MODE_EXPONENTIAL;
+    bool averaging = (config->average_count > 1u);
     if((false != config->continuous_scanning)
         || (_CYHAL_ADCMIC_RESOLUTION != config->resolution)
-        || (1u != config->average_count)
-        || (0u != config->average_mode_flags)
+        || (0u == config->average_count)
+        || (CYHAL_ADC_MAX_AVERAGE_COUNT < config->average_count)
+        || (averaging && (0u == (config->average_mode_flags & supported_flags)))
+        || (0u != (config->average_mode_flags & ~supported_flags))
+        || ((0u != (config->average_mode_flags & CYHAL_ADC_AVG_MODE_ACCUMULATE))
+            && (0u != (config->average_mode_flags & (CYHAL_ADC_AVG_MODE_AVERAGE | CYHAL_ADC_AVG_MODE_EXPONENTIAL))))
         || (0u != config->ext_vref_mv)
         || (CYHAL_ADC_VNEG_VSSA != config->vneg)
         || (CYHAL_ADC_REF_INTERNAL != config->vref)
@@ -468,6 +755,16 @@ cy_rslt_t cyhal_adc_configure(cyhal_adc_t *obj, const cyhal_adc_config_t *config
     {
         return CYHAL_ADC_RSLT_BAD_ARGUMENT;
     }
+    if ((NULL != obj->async_buff_next) || (NULL != obj->cont_ring))
+    {
+        return CYHAL_ADC_RSLT_ERR_BUSY;
+    }
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->average_count = config->average_count;
+    obj->average_mode_flags = config->average_mode_flags;
+    _cyhal_adcmic_reset_filters(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
 
     return CY_RSLT_SUCCESS;
 }
@@ -578,13 +875,15 @@ cy_rslt_t cyhal_adc_channel_configure(cyhal_adc_channel_t *obj, const cyhal_adc_
     CY_ASSERT(NULL != obj);
 
     cy_rslt_t result = CY_RSLT_SUCCESS;
-    if((config->min_acquisition_ns > _CYHAL_ADCMIC_ACQUISITION_TIME_NS) || config->enable_averaging)
+    if(config->min_acquisition_ns > _CYHAL_ADCMIC_ACQUISITION_TIME_NS)
     {
         result = CYHAL_ADC_RSLT_BAD_ARGUMENT;
     }
     if(CY_RSLT_SUCCESS == result)
     {
         obj->enabled = config->enabled;
+        obj->enable_averaging = config->enable_averaging;
+        obj->filter_valid = false;
     }
 
     return result;
@@ -609,13 +908,21 @@ void cyhal_adc_channel_free(cyhal_adc_channel_t *obj)
     }
 }
 
-static int16_t _cyhal_adc_read_raw(const cyhal_adc_channel_t *obj)
+/* Performs a blocking conversion, oversampled if averaging is enabled. Returns false if the ADC is
+ * busy or the conversion timed out. */
+static bool _cyhal_adc_read_raw(const cyhal_adc_channel_t *obj)
 {
-    int16_t data = _CYHAL_ADCMIC_DEFAULT_READ; // Default known value for cases when the read times out
+    bool complete = false;
 
-    if ((obj->adc->dc_calibrated) && (obj->adc->async_scans_remaining == 0))
+    if ((obj->adc->dc_calibrated) && (obj->adc->async_scans_remaining == 0) && (NULL == obj->adc->cont_ring))
     {
+        _cyhal_utils_wait_arm(&obj->adc->wait);
+
         uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->adc->waiter = &obj->adc->wait;
+        obj->adc->current_channel_index = obj->channel_idx;
+        obj->adc->avg_acc = 0;
+        obj->adc->avg_index = 0u;
         Cy_ADCCOMP_ClearInterrupt(obj->adc->base, CY_ADCCOMP_INTR_CIC);
         Cy_ADCCOMP_ADC_SelectDcChannel(obj->adc->base, obj->channel_sel);
         Cy_ADCCOMP_ADC_Start(obj->adc->base);
@@ -623,43 +930,52 @@ static int16_t _cyhal_adc_read_raw(const cyhal_adc_channel_t *obj)
         Cy_ADCCOMP_EnableInterrupt(obj->adc->base, CY_ADCCOMP_INTR_CIC);
         cyhal_system_critical_section_exit(savedIntrStatus);
 
-        int retry = 1000;
+        /* Conversion should take ~2 us, times the number of oversampled conversions */
+        uint32_t conversions = _cyhal_adcmic_is_averaging(obj->adc, obj) ? obj->adc->average_count : 1u;
+        complete = _cyhal_utils_wait_for(&obj->adc->wait, _CYHAL_ADCMIC_READ_TIMEOUT_US * conversions);
 
-        while(!obj->adc->conversion_complete && retry > 0)
+        savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->adc->waiter = NULL;
+        if (!complete)
         {
-            cyhal_system_delay_us(1u); /* Conversion should take ~2 us */
-            --retry;
+            Cy_ADCCOMP_DisableInterrupt(obj->adc->base, CY_ADCCOMP_INTR_CIC);
         }
+        cyhal_system_critical_section_exit(savedIntrStatus);
 
-        // Get result and take offset into account
-        data = (retry > 0) ? Cy_ADCCOMP_GetDcResult(obj->adc->base) : data;
         Cy_ADCCOMP_ADC_Stop(obj->adc->base);
     }
 
-    return data;
+    return complete;
 }
 
 uint16_t cyhal_adc_read_u16(const cyhal_adc_channel_t *obj)
 {
     CY_ASSERT(NULL != obj);
-    return (uint16_t)_cyhal_adc_read_raw(obj);;
+    // Default known value for cases when the read times out. The average is returned even in accumulate mode.
+    return _cyhal_adc_read_raw(obj)
+        ? (uint16_t)_cyhal_adcmic_div_round(obj->adc->result_q8, 256)
+        : (uint16_t)_CYHAL_ADCMIC_DEFAULT_READ;
 }
 
 int32_t cyhal_adc_read(const cyhal_adc_channel_t *obj)
 {
     CY_ASSERT(NULL != obj);
-    return (int32_t)(_cyhal_adc_read_raw(obj));;
+    return _cyhal_adc_read_raw(obj)
+        ? _cyhal_adcmic_result_counts(obj->adc, obj)
+        : (int32_t)((int16_t)_CYHAL_ADCMIC_DEFAULT_READ);
 }
 
 int32_t cyhal_adc_read_uv(const cyhal_adc_channel_t *obj)
 {
     CY_ASSERT(NULL != obj);
-    return Cy_ADCCOMP_CountsTo_uVolts(_cyhal_adc_read_raw(obj), &obj->adc->pdl_context);;
+    return _cyhal_adc_read_raw(obj)
+        ? _cyhal_adcmic_result_uv(obj->adc, obj)
+        : Cy_ADCCOMP_CountsTo_uVolts((int16_t)_CYHAL_ADCMIC_DEFAULT_READ, &obj->adc->pdl_context);
 }
 
 static cy_rslt_t _cyhal_adcmic_start_async_read(cyhal_adc_t* obj, size_t num_scan, int32_t* result_list)
 {
-    if ((NULL != obj->async_buff_next) || (!obj->dc_calibrated))
+    if ((NULL != obj->async_buff_next) || (NULL != obj->cont_ring) || (!obj->dc_calibrated))
     {
         /* Transfer already in progress */
         return CYHAL_ADC_RSLT_ERR_BUSY;
@@ -669,6 +985,8 @@ static cy_rslt_t _cyhal_adcmic_start_async_read(cyhal_adc_t* obj, size_t num_sca
     obj->current_channel_index = 0;
     obj->async_scans_remaining = num_scan;
     obj->async_buff_next = result_list;
+    obj->avg_acc = 0;
+    obj->avg_index = 0u;
     _cyhal_adcmic_find_next_channel(obj, &(obj->current_channel_index));
 
     if(NULL == obj->channel_config[obj->current_channel_index]
@@ -722,6 +1040,119 @@ cy_rslt_t cyhal_adc_set_async_mode(cyhal_adc_t *obj, cyhal_async_mode_t mode, ui
     }
 }
 
+cy_rslt_t cyhal_adc_continuous_start(cyhal_adc_t *obj, cyhal_timer_t *timer, int32_t *ring, size_t size,
+                                     size_t watermark, bool in_uv)
+{
+    CY_ASSERT(NULL != obj);
+    uint8_t scan_size = _cyhal_adcmic_count_enabled_channels(obj);
+
+    if ((NULL == timer) || (NULL == ring) || (0u == scan_size) || (0u == size) || (0u != (size % scan_size))
+        || (0u == watermark) || (watermark > size) || obj->using_audio)
+    {
+        return CYHAL_ADC_RSLT_BAD_ARGUMENT;
+    }
+    if ((NULL != obj->async_buff_next) || (NULL != obj->cont_ring) || (!obj->dc_calibrated))
+    {
+        return CYHAL_ADC_RSLT_ERR_BUSY;
+    }
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->cont_timer = timer;
+    obj->cont_size = size;
+    obj->cont_watermark = watermark;
+    obj->cont_head = 0u;
+    obj->cont_tail = 0u;
+    obj->cont_count = 0u;
+    obj->cont_skipped_scans = 0u;
+    obj->cont_scan_size = scan_size;
+    obj->cont_scan_active = false;
+    obj->cont_in_uv = in_uv;
+    obj->cont_ring = ring;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    cyhal_timer_register_callback(timer, _cyhal_adcmic_timer_cb, obj);
+    cyhal_timer_enable_event(timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, true);
+    cy_rslt_t result = cyhal_timer_start(timer);
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        (void)cyhal_adc_continuous_stop(obj);
+    }
+    return result;
+}
+
+cy_rslt_t cyhal_adc_continuous_stop(cyhal_adc_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (NULL != obj->cont_timer)
+    {
+        result = cyhal_timer_stop(obj->cont_timer);
+        cyhal_timer_enable_event(obj->cont_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, false);
+    }
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (obj->cont_scan_active)
+    {
+        // Abandon the scan in progress
+        Cy_ADCCOMP_DisableInterrupt(obj->base, CY_ADCCOMP_INTR_CIC);
+        Cy_ADCCOMP_ADC_Stop(obj->base);
+        obj->cont_scan_active = false;
+    }
+    obj->cont_ring = NULL;
+    obj->cont_timer = NULL;
+    obj->cont_count = 0u;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    return result;
+}
+
+size_t cyhal_adc_continuous_peek(cyhal_adc_t *obj, const int32_t **data)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != data);
+    size_t available = 0u;
+
+    if (NULL != obj->cont_ring)
+    {
+        // cont_count only grows behind our back, so a stale value is safe
+        size_t count = obj->cont_count;
+        size_t contiguous = obj->cont_size - obj->cont_tail;
+        available = (count < contiguous) ? count : contiguous;
+        *data = &obj->cont_ring[obj->cont_tail];
+    }
+    else
+    {
+        *data = NULL;
+    }
+
+    return available;
+}
+
+void cyhal_adc_continuous_consume(cyhal_adc_t *obj, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (NULL != obj->cont_ring)
+    {
+        CY_ASSERT(length <= obj->cont_count);
+        if (length > obj->cont_count)
+        {
+            length = obj->cont_count;
+        }
+        obj->cont_tail = (obj->cont_tail + length) % obj->cont_size;
+        obj->cont_count -= length;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+
+uint32_t cyhal_adc_continuous_get_skipped(const cyhal_adc_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->cont_skipped_scans;
+}
+
 void cyhal_adc_register_callback(cyhal_adc_t *obj, cyhal_adc_event_callback_t callback, void *callback_arg)
 {
     CY_ASSERT(NULL != obj);
@@ -404,6 +404,7 @@ static void _cyhal_audioss_restore_events(_cyhal_audioss_t *obj, bool tx, uint32
 static cy_rslt_t _cyhal_audioss_dma_perform_tx(_cyhal_audioss_t *obj);
 static void _cyhal_audioss_dma_handler_tx(void *callback_arg, cyhal_dma_event_t event);
 static uint8_t _cyhal_audioss_rounded_word_length(_cyhal_audioss_t *obj, bool is_tx);
+static void _cyhal_audioss_dma_count_completed(_cyhal_audioss_t *obj, bool is_tx);
 #endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
 static bool _cyhal_audioss_pm_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode, void* callback_arg);
 static cy_rslt_t _cyhal_audioss_populate_pdl_config(_cyhal_audioss_t *obj, _cyhal_audioss_pdl_config_t* pdl_config,
@@ -414,6 +415,72 @@ static void _cyhal_audioss_reconstruct_pdl_config(_cyhal_audioss_t *obj, _cyhal_
 static cy_rslt_t _cyhal_audioss_compute_sclk_div(_cyhal_audioss_t *obj, uint32_t sample_rate_hz, uint32_t mclk_hz, uint8_t channel_length, uint8_t num_channels, uint16_t *sclk_div);
 static uint32_t _cyhal_audioss_get_num_in_fifo(_cyhal_audioss_t *obj, bool is_tx);
 static void _cyhal_audioss_write_fifo(_cyhal_audioss_t *obj, uint32_t value);
+static uint8_t _cyhal_audioss_words_per_frame(_cyhal_audioss_t *obj, bool is_tx);
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+#if !defined(CYHAL_AUDIOSS_STATS_GET_TICKS)
+/* Default to the CPU cycle counter, which is enabled when an I2S/TDM object is initialized */
+#define CYHAL_AUDIOSS_STATS_GET_TICKS() (DWT->CYCCNT)
+#define _CYHAL_AUDIOSS_STATS_USE_DWT
+#endif
+
+static void _cyhal_audioss_stats_reset(_cyhal_audioss_t *obj)
+{
+    memset(&obj->stats, 0, sizeof(obj->stats));
+    /* The level can only go down from here */
+    obj->stats.tx_fifo_min = _CYHAL_AUDIOSS_FIFO_DEPTH;
+}
+
+/* Records the FIFO level on entry to the interrupt of one direction, if data is being streamed
+ * in that direction. Returns the entry time. */
+static uint32_t _cyhal_audioss_stats_isr_enter(_cyhal_audioss_t *obj, bool is_tx)
+{
+    uint32_t start_ticks = CYHAL_AUDIOSS_STATS_GET_TICKS();
+    if(is_tx)
+    {
+        if(NULL != obj->async_tx_buff)
+        {
+            uint32_t level = _cyhal_audioss_get_num_in_fifo(obj, true);
+            if(level < obj->stats.tx_fifo_min)
+            {
+                obj->stats.tx_fifo_min = level;
+            }
+        }
+    }
+    else
+    {
+        if(NULL != obj->async_rx_buff)
+        {
+            uint32_t level = _cyhal_audioss_get_num_in_fifo(obj, false);
+            if(level > obj->stats.rx_fifo_max)
+            {
+                obj->stats.rx_fifo_max = level;
+            }
+        }
+    }
+    return start_ticks;
+}
+
+/* Records the events and the time spent servicing the interrupt */
+static void _cyhal_audioss_stats_isr_exit(_cyhal_audioss_t *obj, uint32_t event, uint32_t start_ticks)
+{
+    uint32_t ticks = CYHAL_AUDIOSS_STATS_GET_TICKS() - start_ticks;
+    obj->stats.isr_count++;
+    obj->stats.isr_ticks += ticks;
+    if(ticks > obj->stats.isr_max_ticks)
+    {
+        obj->stats.isr_max_ticks = ticks;
+    }
+    if(0u != (event & obj->interface->event_tx_underflow))
+    {
+        obj->stats.tx_underruns++;
+    }
+    if(0u != (event & obj->interface->event_rx_overflow))
+    {
+        obj->stats.rx_overruns++;
+    }
+}
+#endif /* defined(CYHAL_AUDIOSS_STATS_ENABLED) */
 
 cy_rslt_t _cyhal_audioss_init_clock(_cyhal_audioss_t *obj, const cyhal_clock_t* clk, bool all_mclk)
 {
@@ -529,6 +596,13 @@ cy_rslt_t _cyhal_audioss_init_hw(_cyhal_audioss_t *obj, const _cyhal_audioss_pdl
 #if (CYHAL_DRIVER_AVAILABLE_SYSPM)
         _cyhal_syspm_register_peripheral_callback(&(obj->pm_callback));
 #endif /*  (CYHAL_DRIVER_AVAILABLE_SYSPM) */
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+        _cyhal_audioss_stats_reset(obj);
+#if defined(_CYHAL_AUDIOSS_STATS_USE_DWT)
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+#endif
         _cyhal_audioss_config_structs[tdm_inst] = obj;
 #if defined(CY_IP_MXAUDIOSS)
         _cyhal_irq_register(_cyhal_audioss_irq_n[tdm_inst], CYHAL_ISR_PRIORITY_DEFAULT, _cyhal_audioss_irq_handler);
@@ -590,8 +664,13 @@ cy_rslt_t _cyhal_audioss_init(_cyhal_audioss_t *obj, const _cyhal_audioss_pins_t
     obj->callback_data.callback_arg = NULL;
     obj->async_mode = CYHAL_ASYNC_SW;
     obj->async_tx_buff = NULL;
+    obj->tx_circular = false;
+    obj->tx_queue_count = 0u;
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
     obj->async_rx_buff = NULL;
+    obj->rx_circular = false;
+    obj->rx_queue_count = 0u;
+    obj->rx_demux_num_slots = 0u;
 #endif
     obj->tx_dma.resource.type = CYHAL_RSC_INVALID;
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
@@ -1073,12 +1152,20 @@ void _cyhal_audioss_free(_cyhal_audioss_t *obj)
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
     if(CYHAL_RSC_INVALID != obj->rx_dma.resource.type)
     {
+        if(obj->rx_circular)
+        {
+            cyhal_dma_disable(&obj->rx_dma);
+        }
         cyhal_dma_free(&obj->rx_dma);
     }
 #endif /* defined(_CYHAL_AUDIOSS_RX_ENABLED) */
 
     if(CYHAL_RSC_INVALID != obj->tx_dma.resource.type)
     {
+        if(obj->tx_circular)
+        {
+            cyhal_dma_disable(&obj->tx_dma);
+        }
         cyhal_dma_free(&obj->tx_dma);
     }
 #endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
@@ -1115,6 +1202,25 @@ static bool _cyhal_audioss_is_direction_enabled(_cyhal_audioss_t *obj, bool is_t
 #endif
 }
 
+/* Source clock frequencies that are exact multiples of the bit clocks of the standard sample rates.
+ * The first two cover the 8/16/32/48/96/192 kHz and 11.025/22.05/44.1/88.2/176.4 kHz families,
+ * so switching between rates of a family does not change the source clock. */
+static const uint32_t _cyhal_audioss_std_clock_hz[] =
+{
+    24576000u, 22579200u, 49152000u, 45158400u, 12288000u, 11289600u
+};
+
+/* Returns the divider that gives exactly target_hz from source_hz, or 0 if there is none in range */
+static uint16_t _cyhal_audioss_exact_sclk_div(uint32_t source_hz, uint32_t target_hz, uint16_t min_div, uint16_t max_div, uint16_t increment)
+{
+    if((0u == source_hz) || (0u == target_hz) || (0u != (source_hz % target_hz)))
+    {
+        return 0u;
+    }
+    uint32_t div = source_hz / target_hz;
+    return ((div >= min_div) && (div <= max_div) && (0u == ((div - min_div) % increment))) ? (uint16_t)div : 0u;
+}
+
 /* Note: This function is called prior to PDL init, and again from set_sample_rate. This means that
  * it cannot safely query either register values (which may not be initialized), nor pin values (which
  * are not populated in the configurator init flow) */
@@ -1136,9 +1242,32 @@ static cy_rslt_t _cyhal_audioss_compute_sclk_div(_cyhal_audioss_t *obj, uint32_t
 
     if(obj->is_clock_owned)
     {
+#if defined(CY_IP_MXAUDIOSS)
+        // This IP has a hard-wired 8x divider
+        const uint32_t exact_target = sclk_target * 8;
+#elif defined(CY_IP_MXTDM)
+        const uint32_t exact_target = sclk_target;
+#endif
+        // If the clock is already running at a multiple of the target, which is the case when
+        // switching between rates of the same family, keep it. Changing the frequency of the
+        // audio PLL means relocking it, which takes long enough to be heard.
+        uint16_t exact_div = _cyhal_audioss_exact_sclk_div(cyhal_clock_get_frequency(&(obj->clock)), exact_target,
+                                                           MIN_SCLK_DIVIDER, MAX_SCLK_DIVIDER, SCLK_INCREMENT);
+        // Otherwise pick a standard audio frequency that gives the target with zero error.
+        for(size_t i = 0; (0u == exact_div) && (i < sizeof(_cyhal_audioss_std_clock_hz) / sizeof(_cyhal_audioss_std_clock_hz[0])); i++)
+        {
+            uint16_t div = _cyhal_audioss_exact_sclk_div(_cyhal_audioss_std_clock_hz[i], exact_target,
+                                                         MIN_SCLK_DIVIDER, MAX_SCLK_DIVIDER, SCLK_INCREMENT);
+            if((0u != div) && (CY_RSLT_SUCCESS == _cyhal_utils_set_clock_frequency(&(obj->clock), _cyhal_audioss_std_clock_hz[i], &SCLK_TOLERANCE)))
+            {
+                exact_div = div;
+            }
+        }
+        *sclk_div = exact_div;
+
         // Try each of the divider values that we support internally, and see whether any of them gets us
         // within our tolerance of a frequency that our source clock can provide.
-        for(uint16_t i = MIN_SCLK_DIVIDER; i <= MAX_SCLK_DIVIDER; i += SCLK_INCREMENT)
+        for(uint16_t i = MIN_SCLK_DIVIDER; (0u == *sclk_div) && (i <= MAX_SCLK_DIVIDER); i += SCLK_INCREMENT)
         {
 #if defined(CY_IP_MXAUDIOSS)
             // This IP has a hard-wired 8x divider
@@ -1350,23 +1479,145 @@ cy_rslt_t _cyhal_audioss_clear_rx(_cyhal_audioss_t *obj)
 #endif
 }
 
+#if !defined(CYHAL_AUDIOSS_TIMESTAMP_GET_TICKS)
+/* Default to the CPU cycle counter, which is enabled by the first duplex start */
+#define CYHAL_AUDIOSS_TIMESTAMP_GET_TICKS() (DWT->CYCCNT)
+#define _CYHAL_AUDIOSS_TIMESTAMP_USE_DWT
+#endif
+
+cy_rslt_t _cyhal_audioss_start_duplex(_cyhal_audioss_t *obj, uint32_t *start_ticks)
+{
+    CY_ASSERT(NULL != obj);
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if (obj->pm_transition_ready)
+    {
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    if (!_cyhal_audioss_is_direction_enabled(obj, true) || !_cyhal_audioss_is_direction_enabled(obj, false)
+        || _cyhal_audioss_is_tx_enabled(obj) || _cyhal_audioss_is_rx_enabled(obj))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+#if defined(_CYHAL_AUDIOSS_TIMESTAMP_USE_DWT)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    // Discard anything left over in the RX FIFO so that its first word is from the first frame.
+    // The TX FIFO is left alone; it holds the data prefilled by the application.
+    (void)_cyhal_audioss_clear_rx(obj);
+
+    // Nothing may delay the second direction, so that both start on the same frame
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    uint32_t ticks = CYHAL_AUDIOSS_TIMESTAMP_GET_TICKS();
+#if defined(CY_IP_MXAUDIOSS)
+    // A single write starts both directions on the same clock edge
+    REG_I2S_CMD(obj->base) |= (I2S_CMD_TX_START_Msk | I2S_CMD_RX_START_Msk);
+#elif defined(CY_IP_MXTDM)
+    // There is no command that starts both directions. Read both control registers first so that
+    // only two back-to-back stores separate the directions; if a frame edge falls between them,
+    // TX starts one frame late (see CYHAL_AUDIOSS_DUPLEX_MAX_SKEW_FRAMES).
+    uint32_t rx_ctl = TDM_STRUCT_RX_CTL(&obj->base->TDM_RX_STRUCT) | TDM_TDM_STRUCT_TDM_RX_STRUCT_RX_CTL_ENABLED_Msk;
+    uint32_t tx_ctl = TDM_STRUCT_TX_CTL(&obj->base->TDM_TX_STRUCT) | TDM_TDM_STRUCT_TDM_TX_STRUCT_TX_CTL_ENABLED_Msk;
+    TDM_STRUCT_RX_CTL(&obj->base->TDM_RX_STRUCT) = rx_ctl;
+    TDM_STRUCT_TX_CTL(&obj->base->TDM_TX_STRUCT) = tx_ctl;
+#endif
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if (NULL != start_ticks)
+    {
+        *start_ticks = ticks;
+    }
+    return CY_RSLT_SUCCESS;
+#else
+    CY_UNUSED_PARAMETER(start_ticks);
+    return obj->interface->err_not_supported;
+#endif
+}
+
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+// Moves count words from the RX FIFO into the buffer. The caller has already checked that the
+// FIFO holds at least count words, so the FIFO level does not need to be polled in between.
+static inline uint8_t* _cyhal_audioss_read_block_8(_cyhal_audioss_t *obj, uint8_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        buffer[0] = (uint8_t)_cyhal_audioss_read_fifo(obj);
+        buffer[1] = (uint8_t)_cyhal_audioss_read_fifo(obj);
+        buffer[2] = (uint8_t)_cyhal_audioss_read_fifo(obj);
+        buffer[3] = (uint8_t)_cyhal_audioss_read_fifo(obj);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        *buffer = (uint8_t)_cyhal_audioss_read_fifo(obj);
+        ++buffer;
+    }
+    return buffer;
+}
+
+static inline uint16_t* _cyhal_audioss_read_block_16(_cyhal_audioss_t *obj, uint16_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        buffer[0] = (uint16_t)_cyhal_audioss_read_fifo(obj);
+        buffer[1] = (uint16_t)_cyhal_audioss_read_fifo(obj);
+        buffer[2] = (uint16_t)_cyhal_audioss_read_fifo(obj);
+        buffer[3] = (uint16_t)_cyhal_audioss_read_fifo(obj);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        *buffer = (uint16_t)_cyhal_audioss_read_fifo(obj);
+        ++buffer;
+    }
+    return buffer;
+}
+
+static inline uint32_t* _cyhal_audioss_read_block_32(_cyhal_audioss_t *obj, uint32_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        buffer[0] = _cyhal_audioss_read_fifo(obj);
+        buffer[1] = _cyhal_audioss_read_fifo(obj);
+        buffer[2] = _cyhal_audioss_read_fifo(obj);
+        buffer[3] = _cyhal_audioss_read_fifo(obj);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        *buffer = _cyhal_audioss_read_fifo(obj);
+        ++buffer;
+    }
+    return buffer;
+}
+
 // Reads until empty, then updates the length and buffer address to their new locations
 static void _cyhal_audioss_read_until_empty(_cyhal_audioss_t *obj, void** buffer, size_t* length)
 {
+    size_t start_length = *length;
     // The buffer is the smallest type that will hold the word length
     // The structure of this function deliberately accepts duplication of the outer loop
     // structure in order to avoid having to recheck the word length every time around,
     // because this function is in a performance sensitive code path.
+    // The FIFO level is read once per block of words rather than once per word.
     if(obj->word_length_rx <= 8)
     {
         uint8_t *cast_buffer = (uint8_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, false) > 0)
+        while(*length > 0)
         {
-            *cast_buffer = (uint8_t)_cyhal_audioss_read_fifo(obj);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_num_in_fifo(obj, false);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_read_block_8(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
@@ -1374,11 +1625,19 @@ static void _cyhal_audioss_read_until_empty(_cyhal_audioss_t *obj, void** buffer
     {
         uint16_t *cast_buffer = (uint16_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, false) > 0)
+        while(*length > 0)
         {
-            *cast_buffer = (uint16_t)_cyhal_audioss_read_fifo(obj);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_num_in_fifo(obj, false);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_read_block_16(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
@@ -1387,15 +1646,86 @@ static void _cyhal_audioss_read_until_empty(_cyhal_audioss_t *obj, void** buffer
         CY_ASSERT(obj->word_length_rx <= 32);
         uint32_t *cast_buffer = (uint32_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, false) > 0)
+        while(*length > 0)
         {
-            *cast_buffer = _cyhal_audioss_read_fifo(obj);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_num_in_fifo(obj, false);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_read_block_32(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
+    obj->rx_word_count += (uint32_t)(start_length - *length);
+}
+
+// Distributes the words in the RX FIFO round robin over the per-slot buffers of a demultiplexing
+// read. Slots without a buffer are read from the FIFO and dropped.
+static void _cyhal_audioss_read_demux_until_empty(_cyhal_audioss_t *obj)
+{
+    uint8_t word_bytes = (obj->word_length_rx <= 8) ? 1u : ((obj->word_length_rx <= 16) ? 2u : 4u);
+    while(obj->async_rx_length > 0)
+    {
+        uint32_t count = _cyhal_audioss_get_num_in_fifo(obj, false);
+        if(0u == count)
+        {
+            break;
+        }
+        if(count > obj->async_rx_length)
+        {
+            count = (uint32_t)obj->async_rx_length;
+        }
+        obj->async_rx_length -= count;
+        obj->rx_word_count += count;
+        for(; count > 0u; --count)
+        {
+            uint32_t value = _cyhal_audioss_read_fifo(obj);
+            void *slot_buffer = obj->rx_demux_buffers[obj->rx_demux_slot];
+            if(NULL != slot_buffer)
+            {
+                if(1u == word_bytes)
+                {
+                    ((uint8_t*)slot_buffer)[obj->rx_demux_frame] = (uint8_t)value;
+                }
+                else if(2u == word_bytes)
+                {
+                    ((uint16_t*)slot_buffer)[obj->rx_demux_frame] = (uint16_t)value;
+                }
+                else
+                {
+                    ((uint32_t*)slot_buffer)[obj->rx_demux_frame] = value;
+                }
+            }
+            if(++obj->rx_demux_slot == obj->rx_demux_num_slots)
+            {
+                obj->rx_demux_slot = 0u;
+                ++obj->rx_demux_frame;
+            }
+        }
+    }
+}
+
+// Reads the RX FIFO into the buffer(s) of the async read in progress
+static void _cyhal_audioss_read_async_until_empty(_cyhal_audioss_t *obj)
+{
+    if(0u != obj->rx_demux_num_slots)
+    {
+        _cyhal_audioss_read_demux_until_empty(obj);
+    }
+    else
+    {
+        // Safe to cast away volatile here because all callers are in a critical section,
+        // so it should not change out from under us during this call
+        _cyhal_audioss_read_until_empty(obj, (void**)(&obj->async_rx_buff), (size_t*)(&obj->async_rx_length));
+    }
 }
+
 #endif
 
 cy_rslt_t _cyhal_audioss_read(_cyhal_audioss_t *obj, void *data, size_t* length)
@@ -1418,21 +1748,95 @@ cy_rslt_t _cyhal_audioss_read(_cyhal_audioss_t *obj, void *data, size_t* length)
 #endif
 }
 
+// Moves count words from the buffer into the TX FIFO. The caller has already checked that the
+// FIFO has room for at least count words, so the FIFO level does not need to be polled in between.
+static inline const uint8_t* _cyhal_audioss_write_block_8(_cyhal_audioss_t *obj, const uint8_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        _cyhal_audioss_write_fifo(obj, buffer[0]);
+        _cyhal_audioss_write_fifo(obj, buffer[1]);
+        _cyhal_audioss_write_fifo(obj, buffer[2]);
+        _cyhal_audioss_write_fifo(obj, buffer[3]);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        _cyhal_audioss_write_fifo(obj, *buffer);
+        ++buffer;
+    }
+    return buffer;
+}
+
+static inline const uint16_t* _cyhal_audioss_write_block_16(_cyhal_audioss_t *obj, const uint16_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        _cyhal_audioss_write_fifo(obj, buffer[0]);
+        _cyhal_audioss_write_fifo(obj, buffer[1]);
+        _cyhal_audioss_write_fifo(obj, buffer[2]);
+        _cyhal_audioss_write_fifo(obj, buffer[3]);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        _cyhal_audioss_write_fifo(obj, *buffer);
+        ++buffer;
+    }
+    return buffer;
+}
+
+static inline const uint32_t* _cyhal_audioss_write_block_32(_cyhal_audioss_t *obj, const uint32_t *buffer, uint32_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        _cyhal_audioss_write_fifo(obj, buffer[0]);
+        _cyhal_audioss_write_fifo(obj, buffer[1]);
+        _cyhal_audioss_write_fifo(obj, buffer[2]);
+        _cyhal_audioss_write_fifo(obj, buffer[3]);
+        buffer += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        _cyhal_audioss_write_fifo(obj, *buffer);
+        ++buffer;
+    }
+    return buffer;
+}
+
+// Number of words that can be written to the TX FIFO. The level is clamped to the depth so that
+// an unexpected reading cannot wrap the unsigned difference into a huge count.
+static inline uint32_t _cyhal_audioss_get_tx_fifo_space(_cyhal_audioss_t *obj)
+{
+    uint32_t level = _cyhal_audioss_get_num_in_fifo(obj, true);
+    return (level < (uint32_t)_CYHAL_AUDIOSS_FIFO_DEPTH) ? ((uint32_t)_CYHAL_AUDIOSS_FIFO_DEPTH - level) : 0u;
+}
+
 static void _cyhal_audioss_write_until_full(_cyhal_audioss_t *obj, const void** buffer, size_t *length)
 {
+    size_t start_length = *length;
     // The buffer is the smallest type that will hold the word length
     // The structure of this function deliberately accepts duplication of the outer loop
     // structure in order to avoid having to recheck the word length every time around,
     // because this function is in a performance sensitive code path.
+    // The FIFO level is read once per block of words rather than once per word.
     if(obj->word_length_tx <= 8)
     {
         const uint8_t *cast_buffer = (const uint8_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, true) < _CYHAL_AUDIOSS_FIFO_DEPTH)
+        while(*length > 0)
         {
-            _cyhal_audioss_write_fifo(obj, *cast_buffer);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_tx_fifo_space(obj);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_write_block_8(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
@@ -1440,11 +1844,19 @@ static void _cyhal_audioss_write_until_full(_cyhal_audioss_t *obj, const void**
     {
         const uint16_t *cast_buffer = (const uint16_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, true) < _CYHAL_AUDIOSS_FIFO_DEPTH)
+        while(*length > 0)
         {
-            _cyhal_audioss_write_fifo(obj, *cast_buffer);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_tx_fifo_space(obj);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_write_block_16(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
@@ -1453,14 +1865,23 @@ static void _cyhal_audioss_write_until_full(_cyhal_audioss_t *obj, const void**
         CY_ASSERT(obj->word_length_tx <= 32);
         const uint32_t *cast_buffer = (const uint32_t*)(*buffer);
 
-        while(*length > 0 && _cyhal_audioss_get_num_in_fifo(obj, true) < _CYHAL_AUDIOSS_FIFO_DEPTH)
+        while(*length > 0)
         {
-            _cyhal_audioss_write_fifo(obj, *cast_buffer);
-            ++cast_buffer;
-            --(*length);
+            uint32_t count = _cyhal_audioss_get_tx_fifo_space(obj);
+            if(0u == count)
+            {
+                break;
+            }
+            if(count > *length)
+            {
+                count = (uint32_t)(*length);
+            }
+            cast_buffer = _cyhal_audioss_write_block_32(obj, cast_buffer, count);
+            *length -= count;
         }
         *buffer = (void*)cast_buffer;
     }
+    obj->tx_word_count += (uint32_t)(start_length - *length);
 }
 
 cy_rslt_t _cyhal_audioss_write(_cyhal_audioss_t *obj, const void *data, size_t *length)
@@ -1543,9 +1964,7 @@ cy_rslt_t _cyhal_audioss_read_async(_cyhal_audioss_t *obj, void *rx, size_t rx_l
              * interleave with it. So do a "mini critical section" and disable the interrupts for this block only.
              */
             uint32_t old_events = _cyhal_audioss_disable_events(obj, false);
-            // Safe to cast away volatile here because we're calling read_until_empty from within
-            // a critical section, so it should not change out from under us during this call
-            _cyhal_audioss_read_until_empty(obj, (void**)(&obj->async_rx_buff), (size_t*)(&obj->async_rx_length));
+            _cyhal_audioss_read_async_until_empty(obj);
             _cyhal_audioss_update_rx_trigger_level(obj);
             _cyhal_audioss_restore_events(obj, false, old_events);
             if(obj->async_rx_length > 0)
@@ -1861,6 +2280,29 @@ static uint8_t _cyhal_audioss_rounded_word_length(_cyhal_audioss_t *obj, bool is
 #endif
     return 32u;
 }
+
+/* Add the words of a finished non-circular DMA transfer to the word count.
+*  Must be called from within a critical section.
+*/
+static void _cyhal_audioss_dma_count_completed(_cyhal_audioss_t *obj, bool is_tx)
+{
+    if (is_tx)
+    {
+        if ((0u != obj->tx_dma_pending_words) && !cyhal_dma_is_busy(&(obj->tx_dma)))
+        {
+            obj->tx_word_count += obj->tx_dma_pending_words;
+            obj->tx_dma_pending_words = 0u;
+        }
+    }
+    else
+    {
+        if ((0u != obj->rx_dma_pending_words) && !cyhal_dma_is_busy(&(obj->rx_dma)))
+        {
+            obj->rx_word_count += obj->rx_dma_pending_words;
+            obj->rx_dma_pending_words = 0u;
+        }
+    }
+}
 #endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
 
 cy_rslt_t _cyhal_audioss_write_async(_cyhal_audioss_t *obj, const void *tx, size_t tx_length)
@@ -1998,6 +2440,15 @@ cy_rslt_t _cyhal_audioss_abort_read_async(_cyhal_audioss_t *obj)
 {
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
     uint32_t saved_intr = cyhal_system_critical_section_enter();
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if(obj->rx_circular)
+    {
+        cyhal_dma_disable(&obj->rx_dma);
+        obj->rx_circular = false;
+    }
+#endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
+    obj->rx_queue_count = 0u;
+    obj->rx_demux_num_slots = 0u;
     obj->async_rx_buff = NULL;
     _cyhal_audioss_update_enabled_events(obj);
     cyhal_system_critical_section_exit(saved_intr);
@@ -2010,42 +2461,441 @@ cy_rslt_t _cyhal_audioss_abort_read_async(_cyhal_audioss_t *obj)
 cy_rslt_t _cyhal_audioss_abort_write_async(_cyhal_audioss_t *obj)
 {
     uint32_t saved_intr = cyhal_system_critical_section_enter();
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if(obj->tx_circular)
+    {
+        cyhal_dma_disable(&obj->tx_dma);
+        obj->tx_circular = false;
+    }
+#endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
+    obj->tx_queue_count = 0u;
     obj->async_tx_buff = NULL;
     _cyhal_audioss_update_enabled_events(obj);
     cyhal_system_critical_section_exit(saved_intr);
     return CY_RSLT_SUCCESS;
 }
 
-#if defined(CY_IP_MXAUDIOSS)
-static uint8_t _cyhal_audioss_length_from_pdl(cy_en_i2s_len_t pdl_length)
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+/* Programs the DMA to loop over a ring of num_periods periods, each period_length words long.
+ * Once started, the DMA is paced by the FIFO trigger and needs no further CPU involvement. */
+static cy_rslt_t _cyhal_audioss_dma_start_circular(_cyhal_audioss_t *obj, bool is_tx, void *ring, size_t period_length, size_t num_periods)
 {
-    switch(pdl_length)
+    cyhal_dma_t *dma = is_tx ? &obj->tx_dma : &obj->rx_dma;
+    cyhal_dma_lli_t *lli = is_tx ? obj->tx_lli : obj->rx_lli;
+    uint8_t word_length = _cyhal_audioss_rounded_word_length(obj, is_tx);
+    size_t period_bytes = period_length * (word_length / 8);
+#if defined(CY_IP_MXAUDIOSS)
+    uint32_t fifo_addr = is_tx ? (uint32_t)(&(obj->base->TX_FIFO_WR)) : (uint32_t)(&(obj->base->RX_FIFO_RD));
+#elif defined(CY_IP_MXTDM)
+    uint32_t fifo_addr = is_tx ? (uint32_t)(&(obj->base->TDM_TX_STRUCT.TX_FIFO_WR)) : (uint32_t)(&(obj->base->TDM_RX_STRUCT.RX_FIFO_RD));
+#endif
+    cyhal_dma_cfg_t dma_cfg[_CYHAL_AUDIOSS_MAX_PERIODS];
+
+    for(size_t i = 0; i < num_periods; i++)
     {
-        case CY_I2S_LEN8:
-            return 8u;
-        case CY_I2S_LEN16:
-            return 16u;
-        case CY_I2S_LEN18:
-            return 18u;
-        case CY_I2S_LEN20:
-            return 20u;
-        case CY_I2S_LEN24:
-            return 24u;
-        case CY_I2S_LEN32:
-            return 32u;
-        default:
-            CY_ASSERT(false); /* Should never get here */
-            return 32u;
+        uint32_t period_addr = (uint32_t)(((uint8_t*)ring) + (i * period_bytes));
+        dma_cfg[i].src_addr = is_tx ? period_addr : fifo_addr;
+        dma_cfg[i].src_increment = is_tx ? 1 : 0;
+        dma_cfg[i].dst_addr = is_tx ? fifo_addr : period_addr;
+        dma_cfg[i].dst_increment = is_tx ? 0 : 1;
+        dma_cfg[i].transfer_width = word_length;
+        dma_cfg[i].length = period_length;
+#if defined(COMPONENT_CAT5)
+        dma_cfg[i].burst_size = 128;
+#else
+        dma_cfg[i].burst_size = 0;
+#endif
+        dma_cfg[i].action = CYHAL_DMA_TRANSFER_FULL;
+    }
+
+    if(is_tx)
+    {
+        obj->tx_period_length = period_length;
+    }
+    else
+    {
+        obj->rx_period_length = period_length;
+    }
+
+    cy_rslt_t result = cyhal_dma_configure_circular(dma, dma_cfg, num_periods, lli);
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        // Every period raises the complete event, which is reported as the async complete event
+        cyhal_dma_enable_event(dma, CYHAL_DMA_TRANSFER_COMPLETE, obj->async_dma_priority, true);
+        result = cyhal_dma_enable(dma);
+    }
+
+    if(CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_dma_start_transfer(dma);
     }
+
+    return result;
 }
 
-static cy_rslt_t _cyhal_audioss_length_to_pdl(uint8_t user_length, cy_en_i2s_len_t *pdl_length, const _cyhal_audioss_t *obj)
+static cy_rslt_t _cyhal_audioss_check_circular(_cyhal_audioss_t *obj, const void *ring, size_t period_length, size_t num_periods)
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-    switch(user_length)
+    if (obj->pm_transition_ready)
     {
-        case 8u:
-            *pdl_length = CY_I2S_LEN8;
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    if ((NULL == ring) || (0u == period_length) || (num_periods < 2u) || (num_periods > _CYHAL_AUDIOSS_MAX_PERIODS)
+        || (CYHAL_ASYNC_DMA != obj->async_mode))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+    return CY_RSLT_SUCCESS;
+}
+#endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
+
+cy_rslt_t _cyhal_audioss_write_circular(_cyhal_audioss_t *obj, const void *tx, size_t period_length, size_t num_periods)
+{
+    CY_ASSERT(NULL != obj);
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+    CY_ASSERT(false == _cyhal_audioss_is_write_pending(obj));
+
+    cy_rslt_t result = _cyhal_audioss_check_circular(obj, tx, period_length, num_periods);
+    if(CY_RSLT_SUCCESS == result)
+    {
+        // The DMA is never reprogrammed while the ring is running, so leave the remaining length
+        // at zero to keep the FIFO events from being enabled on its behalf
+        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->async_tx_buff = tx;
+        obj->async_tx_length = 0;
+        obj->tx_circular = true;
+        cyhal_system_critical_section_exit(savedIntrStatus);
+
+        result = _cyhal_audioss_dma_start_circular(obj, true, (void*)tx, period_length, num_periods);
+        if(CY_RSLT_SUCCESS != result)
+        {
+            (void)_cyhal_audioss_abort_write_async(obj);
+        }
+    }
+    return result;
+#else
+    CY_UNUSED_PARAMETER(tx);
+    CY_UNUSED_PARAMETER(period_length);
+    CY_UNUSED_PARAMETER(num_periods);
+    return obj->interface->err_not_supported;
+#endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
+}
+
+cy_rslt_t _cyhal_audioss_read_circular(_cyhal_audioss_t *obj, void *rx, size_t period_length, size_t num_periods)
+{
+    CY_ASSERT(NULL != obj);
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED) && (CYHAL_DRIVER_AVAILABLE_DMA)
+    CY_ASSERT(false == _cyhal_audioss_is_read_pending(obj));
+
+    cy_rslt_t result = _cyhal_audioss_check_circular(obj, rx, period_length, num_periods);
+    if(CY_RSLT_SUCCESS == result)
+    {
+        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->async_rx_buff = rx;
+        obj->async_rx_length = 0;
+        obj->rx_circular = true;
+        cyhal_system_critical_section_exit(savedIntrStatus);
+
+        result = _cyhal_audioss_dma_start_circular(obj, false, rx, period_length, num_periods);
+        if(CY_RSLT_SUCCESS != result)
+        {
+            (void)_cyhal_audioss_abort_read_async(obj);
+        }
+    }
+    return result;
+#else
+    CY_UNUSED_PARAMETER(rx);
+    CY_UNUSED_PARAMETER(period_length);
+    CY_UNUSED_PARAMETER(num_periods);
+    return obj->interface->err_not_supported;
+#endif /* defined(_CYHAL_AUDIOSS_RX_ENABLED) && (CYHAL_DRIVER_AVAILABLE_DMA) */
+}
+
+cy_rslt_t _cyhal_audioss_queue_write_async(_cyhal_audioss_t *obj, const void *tx, size_t tx_length)
+{
+    CY_ASSERT(NULL != obj);
+    if (obj->pm_transition_ready)
+    {
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    if ((NULL == tx) || (0u == tx_length))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool is_idle = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (NULL == obj->async_tx_buff)
+    {
+        is_idle = true;
+    }
+    else if (obj->tx_circular || (CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH == obj->tx_queue_count))
+    {
+        result = obj->interface->err_busy;
+    }
+    else
+    {
+        _cyhal_audioss_queue_entry_t *entry =
+            &obj->tx_queue[(obj->tx_queue_head + obj->tx_queue_count) % CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH];
+        entry->buff = (void*)tx;
+        entry->length = tx_length;
+        obj->tx_queue_count++;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if (is_idle)
+    {
+        result = _cyhal_audioss_write_async(obj, tx, tx_length);
+    }
+    return result;
+}
+
+cy_rslt_t _cyhal_audioss_queue_read_async(_cyhal_audioss_t *obj, void *rx, size_t rx_length)
+{
+    CY_ASSERT(NULL != obj);
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if (obj->pm_transition_ready)
+    {
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    if ((NULL == rx) || (0u == rx_length))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool is_idle = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (NULL == obj->async_rx_buff)
+    {
+        is_idle = true;
+    }
+    else if (obj->rx_circular || (CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH == obj->rx_queue_count))
+    {
+        result = obj->interface->err_busy;
+    }
+    else
+    {
+        _cyhal_audioss_queue_entry_t *entry =
+            &obj->rx_queue[(obj->rx_queue_head + obj->rx_queue_count) % CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH];
+        entry->buff = rx;
+        entry->length = rx_length;
+        obj->rx_queue_count++;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if (is_idle)
+    {
+        result = _cyhal_audioss_read_async(obj, rx, rx_length);
+    }
+    return result;
+#else
+    CY_UNUSED_PARAMETER(rx);
+    CY_UNUSED_PARAMETER(rx_length);
+    return obj->interface->err_not_supported;
+#endif
+}
+
+cy_rslt_t _cyhal_audioss_read_demux_async(_cyhal_audioss_t *obj, void * const *slot_buffers, uint8_t num_slots, size_t frames)
+{
+    CY_ASSERT(NULL != obj);
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if (obj->pm_transition_ready)
+    {
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    // The slot buffers are indexed by FIFO word, so there must be exactly one per enabled channel
+    if ((NULL == slot_buffers) || (0u == frames) || (num_slots != _cyhal_audioss_words_per_frame(obj, false)))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+    // The DMA cannot scatter consecutive words to different buffers
+    if (CYHAL_ASYNC_SW != obj->async_mode)
+    {
+        return obj->interface->err_not_supported;
+    }
+
+    bool is_busy = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (_cyhal_audioss_is_read_pending(obj))
+    {
+        // The demux state of the read in progress must not be replaced
+        is_busy = true;
+    }
+    else
+    {
+        obj->rx_demux_buffers = slot_buffers;
+        obj->rx_demux_num_slots = num_slots;
+        obj->rx_demux_slot = 0u;
+        obj->rx_demux_frame = 0u;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    if (is_busy)
+    {
+        return obj->interface->err_busy;
+    }
+
+    // The buffer array stands in for the async buffer so that the read shows up as pending
+    cy_rslt_t result = _cyhal_audioss_read_async(obj, (void*)slot_buffers, frames * num_slots);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        obj->rx_demux_num_slots = 0u;
+    }
+    return result;
+#else
+    CY_UNUSED_PARAMETER(slot_buffers);
+    CY_UNUSED_PARAMETER(num_slots);
+    CY_UNUSED_PARAMETER(frames);
+    return obj->interface->err_not_supported;
+#endif
+}
+
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+cy_rslt_t _cyhal_audioss_get_stats(_cyhal_audioss_t *obj, _cyhal_audioss_stats_t *stats)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != stats);
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    *stats = obj->stats;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return CY_RSLT_SUCCESS;
+}
+
+void _cyhal_audioss_clear_stats(_cyhal_audioss_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    _cyhal_audioss_stats_reset(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+#endif /* defined(CYHAL_AUDIOSS_STATS_ENABLED) */
+
+// Number of FIFO words that make up one frame. Disabled TDM channels are not placed in the FIFO.
+static uint8_t _cyhal_audioss_words_per_frame(_cyhal_audioss_t *obj, bool is_tx)
+{
+#if defined(CY_IP_MXAUDIOSS)
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    uint32_t num_channels = is_tx ? _FLD2VAL(I2S_TX_CTL_CH_NR, REG_I2S_TX_CTL(obj->base))
+                                  : _FLD2VAL(I2S_RX_CTL_CH_NR, REG_I2S_RX_CTL(obj->base));
+#else
+    CY_UNUSED_PARAMETER(is_tx);
+    uint32_t num_channels = _FLD2VAL(I2S_TX_CTL_CH_NR, REG_I2S_TX_CTL(obj->base));
+#endif
+    /* Register is one less than the channel count */
+    return (uint8_t)(num_channels + 1u);
+#elif defined(CY_IP_MXTDM)
+    uint32_t ch_en = is_tx ? TDM_STRUCT_TX_CH_CTL(&obj->base->TDM_TX_STRUCT)
+                           : TDM_STRUCT_RX_CH_CTL(&obj->base->TDM_RX_STRUCT);
+    uint8_t num_channels = 0u;
+    for(; 0u != ch_en; ch_en &= (ch_en - 1u))
+    {
+        ++num_channels;
+    }
+    return num_channels;
+#endif
+}
+
+// Number of words that have gone through the serial interface in the given direction, which is
+// the count of words moved by the driver corrected by the current FIFO level
+static uint32_t _cyhal_audioss_get_line_word_count(_cyhal_audioss_t *obj, bool is_tx)
+{
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+    _cyhal_audioss_dma_count_completed(obj, is_tx);
+#endif
+    uint32_t words = is_tx
+        ? (obj->tx_word_count - _cyhal_audioss_get_num_in_fifo(obj, true))
+        : (obj->rx_word_count + _cyhal_audioss_get_num_in_fifo(obj, false));
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return words;
+}
+
+cy_rslt_t _cyhal_audioss_start_rate_measurement(_cyhal_audioss_t *obj, bool is_tx, uint32_t ref_ticks)
+{
+    CY_ASSERT(NULL != obj);
+#if !defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if (!is_tx)
+    {
+        return obj->interface->err_not_supported;
+    }
+#endif
+    uint32_t words = _cyhal_audioss_get_line_word_count(obj, is_tx);
+    if (is_tx)
+    {
+        obj->tx_rate_start_words = words;
+        obj->tx_rate_start_ticks = ref_ticks;
+    }
+    else
+    {
+        obj->rx_rate_start_words = words;
+        obj->rx_rate_start_ticks = ref_ticks;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t _cyhal_audioss_get_measured_rate(_cyhal_audioss_t *obj, bool is_tx, uint32_t ref_ticks, uint32_t ref_hz, uint32_t *rate_millihz)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != rate_millihz);
+#if !defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if (!is_tx)
+    {
+        return obj->interface->err_not_supported;
+    }
+#endif
+    // Both counters are free running, so unsigned subtraction handles a wrap-around
+    uint32_t words = _cyhal_audioss_get_line_word_count(obj, is_tx)
+                   - (is_tx ? obj->tx_rate_start_words : obj->rx_rate_start_words);
+    uint32_t ticks = ref_ticks - (is_tx ? obj->tx_rate_start_ticks : obj->rx_rate_start_ticks);
+    uint8_t words_per_frame = _cyhal_audioss_words_per_frame(obj, is_tx);
+    if ((0u == ticks) || (0u == ref_hz) || (0u == words_per_frame))
+    {
+        return obj->interface->err_invalid_arg;
+    }
+
+    // rate = words * ref_hz / (ticks * words_per_frame), split into whole and thousandths of a Hz
+    // so that none of the intermediate products can overflow
+    uint64_t num = (uint64_t)words * ref_hz;
+    uint64_t den = (uint64_t)ticks * words_per_frame;
+    uint64_t rate_hz = num / den;
+    uint64_t rate = (rate_hz * 1000u) + (((num % den) * 1000u) / den);
+    *rate_millihz = (rate > UINT32_MAX) ? UINT32_MAX : (uint32_t)rate;
+    return CY_RSLT_SUCCESS;
+}
+
+#if defined(CY_IP_MXAUDIOSS)
+static uint8_t _cyhal_audioss_length_from_pdl(cy_en_i2s_len_t pdl_length)
+{
+    switch(pdl_length)
+    {
+        case CY_I2S_LEN8:
+            return 8u;
+        case CY_I2S_LEN16:
+            return 16u;
+        case CY_I2S_LEN18:
+            return 18u;
+        case CY_I2S_LEN20:
+            return 20u;
+        case CY_I2S_LEN24:
+            return 24u;
+        case CY_I2S_LEN32:
+            return 32u;
+        default:
+            CY_ASSERT(false); /* Should never get here */
+            return 32u;
+    }
+}
+
+static cy_rslt_t _cyhal_audioss_length_to_pdl(uint8_t user_length, cy_en_i2s_len_t *pdl_length, const _cyhal_audioss_t *obj)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    switch(user_length)
+    {
+        case 8u:
+            *pdl_length = CY_I2S_LEN8;
             break;
         case 16u:
             *pdl_length = CY_I2S_LEN16;
@@ -2146,10 +2996,19 @@ static void _cyhal_audioss_irq_handler(void)
     uint8_t block = _cyhal_audioss_get_block_from_irqn(irqn);
     _cyhal_audioss_t* obj = _cyhal_audioss_config_structs[block];
 
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    uint32_t start_ticks = _cyhal_audioss_stats_isr_enter(obj, true);
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    (void)_cyhal_audioss_stats_isr_enter(obj, false);
+#endif
+#endif
     uint32_t interrupt_status = Cy_I2S_GetInterruptStatusMasked(obj->base);
     Cy_I2S_ClearInterrupt(obj->base, interrupt_status);
     uint32_t event = obj->interface->convert_interrupt_cause(interrupt_status);
     _cyhal_audioss_process_event(obj, event);
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    _cyhal_audioss_stats_isr_exit(obj, event, start_ticks);
+#endif
 }
 #elif defined(CY_IP_MXTDM)
 
@@ -2165,10 +3024,16 @@ static void _cyhal_audioss_irq_handler_rx()
     _cyhal_audioss_t* obj = _cyhal_audioss_config_structs[block];
 #endif
 
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    uint32_t start_ticks = _cyhal_audioss_stats_isr_enter(obj, false);
+#endif
     uint32_t interrupt_status = Cy_AudioTDM_GetRxInterruptStatusMasked(&obj->base->TDM_RX_STRUCT);
     Cy_AudioTDM_ClearRxInterrupt(&obj->base->TDM_RX_STRUCT, interrupt_status);
     uint32_t event = obj->interface->convert_interrupt_cause(interrupt_status, false);
     _cyhal_audioss_process_event(obj, event);
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    _cyhal_audioss_stats_isr_exit(obj, event, start_ticks);
+#endif
 #if defined (COMPONENT_CAT5)
     Cy_AudioTDM_EnableInterrupt(obj->base);
 #endif
@@ -2186,10 +3051,16 @@ static void _cyhal_audioss_irq_handler_tx()
      _cyhal_audioss_t* obj = _cyhal_audioss_config_structs[block];
 #endif
 
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    uint32_t start_ticks = _cyhal_audioss_stats_isr_enter(obj, true);
+#endif
     uint32_t interrupt_status = Cy_AudioTDM_GetTxInterruptStatusMasked(&obj->base->TDM_TX_STRUCT);
     Cy_AudioTDM_ClearTxInterrupt(&obj->base->TDM_TX_STRUCT, interrupt_status);
     uint32_t event = obj->interface->convert_interrupt_cause(interrupt_status, true);
     _cyhal_audioss_process_event(obj, event);
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    _cyhal_audioss_stats_isr_exit(obj, event, start_ticks);
+#endif
 #if defined (COMPONENT_CAT5)
     Cy_AudioTDM_EnableInterrupt(obj->base);
 #endif
@@ -2216,6 +3087,19 @@ static void _cyhal_audioss_update_enabled_events(_cyhal_audioss_t *obj)
         events |= (obj->interface->event_mask_full | obj->interface->event_mask_half_full);
     }
 #endif
+#if defined(CYHAL_AUDIOSS_STATS_ENABLED)
+    // Count the underflows and overflows that happen while data is being streamed
+    if(NULL != obj->async_tx_buff)
+    {
+        events |= obj->interface->event_tx_underflow;
+    }
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+    if(NULL != obj->async_rx_buff)
+    {
+        events |= obj->interface->event_rx_overflow;
+    }
+#endif
+#endif
 
 #if defined(CY_IP_MXAUDIOSS)
     uint32_t mask = obj->interface->convert_to_pdl(events);
@@ -2323,6 +3207,9 @@ static cy_rslt_t _cyhal_audioss_dma_perform_rx(_cyhal_audioss_t *obj)
     // managed to bring the FIFO below the threshold
     if(cyhal_dma_is_busy(&(obj->rx_dma)))
         return CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    _cyhal_audioss_dma_count_completed(obj, false);
+    cyhal_system_critical_section_exit(savedIntrStatus);
     /* ISR triggers when we have one more entry in the FIFO than the trigger level */
     size_t transfer_size = _cyhal_audioss_fifo_trigger_level(obj, false) + 1;
     if (transfer_size >= obj->async_rx_length)
@@ -2370,9 +3257,10 @@ static cy_rslt_t _cyhal_audioss_dma_perform_rx(_cyhal_audioss_t *obj)
     if(CY_RSLT_SUCCESS == result)
     {
         size_t increment_bytes = transfer_size * (_cyhal_audioss_rounded_word_length(obj, false) / 8);
-        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        savedIntrStatus = cyhal_system_critical_section_enter();
         obj->async_rx_buff = (void*)(((uint8_t*) obj->async_rx_buff) + increment_bytes);
         obj->async_rx_length -= transfer_size;
+        obj->rx_dma_pending_words = (uint32_t)transfer_size;
         _cyhal_audioss_update_rx_trigger_level(obj);
         _cyhal_audioss_update_enabled_events(obj);
         cyhal_system_critical_section_exit(savedIntrStatus);
@@ -2391,6 +3279,9 @@ static cy_rslt_t _cyhal_audioss_dma_perform_tx(_cyhal_audioss_t *obj)
     // threshold but before the DMA is entirely complete
     if(cyhal_dma_is_busy(&(obj->tx_dma)))
         return CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    _cyhal_audioss_dma_count_completed(obj, true);
+    cyhal_system_critical_section_exit(savedIntrStatus);
 
     CY_ASSERT(NULL != obj->async_tx_buff);
 
@@ -2441,9 +3332,10 @@ static cy_rslt_t _cyhal_audioss_dma_perform_tx(_cyhal_audioss_t *obj)
     if(CY_RSLT_SUCCESS == result)
     {
         size_t increment_bytes = transfer_size * (_cyhal_audioss_rounded_word_length(obj, true) / 8);
-        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        savedIntrStatus = cyhal_system_critical_section_enter();
         obj->async_tx_buff = (void*)(((uint8_t*) obj->async_tx_buff) + increment_bytes);
         obj->async_tx_length -= transfer_size;
+        obj->tx_dma_pending_words = (uint32_t)transfer_size;
 
         // Do this after we've updated async_tx_buff/length because once we have kicked
         // off the final DMA transfer there is no further action we will take on the
@@ -2503,6 +3395,15 @@ static void _cyhal_audioss_dma_handler_rx(void *callback_arg, cyhal_dma_event_t
     CY_ASSERT(CYHAL_DMA_TRANSFER_COMPLETE == event);
 
     _cyhal_audioss_t *obj = (_cyhal_audioss_t*)callback_arg;
+    if(obj->rx_circular)
+    {
+        // A period of the ring has been filled; the DMA carries on with the next one
+        obj->rx_word_count += (uint32_t)obj->rx_period_length;
+        _cyhal_audioss_process_event(obj, obj->interface->event_rx_complete);
+        return;
+    }
+    obj->rx_word_count += obj->rx_dma_pending_words;
+    obj->rx_dma_pending_words = 0u;
 #if defined (COMPONENT_CAT5)
     if( 0 != obj->async_rx_length )
     {
@@ -2529,6 +3430,15 @@ static void _cyhal_audioss_dma_handler_tx(void *callback_arg, cyhal_dma_event_t
     CY_ASSERT(CYHAL_DMA_TRANSFER_COMPLETE == event);
 
     _cyhal_audioss_t *obj = (_cyhal_audioss_t*)callback_arg;
+    if(obj->tx_circular)
+    {
+        // A period of the ring has been sent; the DMA carries on with the next one
+        obj->tx_word_count += (uint32_t)obj->tx_period_length;
+        _cyhal_audioss_process_event(obj, obj->interface->event_tx_complete);
+        return;
+    }
+    obj->tx_word_count += obj->tx_dma_pending_words;
+    obj->tx_dma_pending_words = 0u;
 #if defined (COMPONENT_CAT5)
     if( 0 != obj->async_tx_length )
     {
@@ -2546,7 +3456,91 @@ static void _cyhal_audioss_dma_handler_tx(void *callback_arg, cyhal_dma_event_t
 }
 #endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
 
-static void _cyhal_audioss_process_event(_cyhal_audioss_t *obj, uint32_t event)
+/* Moves on to the next queued TX buffer once the current one is done, or ends the async transfer
+ * if nothing is queued. In SW mode the FIFO is topped up from the new buffer straight away.
+ * Returns true if the new buffer has already been sent as well. */
+static bool _cyhal_audioss_queue_next_tx(_cyhal_audioss_t *obj)
+{
+    bool is_complete = false;
+    bool dequeued = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if(0u == obj->tx_queue_count)
+    {
+        obj->async_tx_buff = NULL;
+    }
+    else
+    {
+        const _cyhal_audioss_queue_entry_t *entry = &obj->tx_queue[obj->tx_queue_head];
+        obj->async_tx_buff = entry->buff;
+        obj->async_tx_length = entry->length;
+        obj->tx_queue_head = (obj->tx_queue_head + 1u) % CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH;
+        obj->tx_queue_count--;
+        dequeued = true;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(dequeued && (CYHAL_ASYNC_SW == obj->async_mode))
+    {
+        /* As in _cyhal_audioss_write_async, only this block's interrupts are held off while the FIFO is filled */
+        uint32_t old_events = _cyhal_audioss_disable_events(obj, true);
+        // Safe to cast away volatile here because the block's events that update the buffer are disabled
+        _cyhal_audioss_write_until_full(obj, (const void**)(&obj->async_tx_buff), (size_t *)(&obj->async_tx_length));
+        _cyhal_audioss_restore_events(obj, true, old_events);
+        is_complete = (0u == obj->async_tx_length);
+    }
+
+    savedIntrStatus = cyhal_system_critical_section_enter();
+    _cyhal_audioss_update_enabled_events(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return is_complete;
+}
+
+#if defined(_CYHAL_AUDIOSS_RX_ENABLED)
+/* RX counterpart of _cyhal_audioss_queue_next_tx */
+static bool _cyhal_audioss_queue_next_rx(_cyhal_audioss_t *obj)
+{
+    bool is_complete = false;
+    bool dequeued = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->rx_demux_num_slots = 0u;
+    if(0u == obj->rx_queue_count)
+    {
+        obj->async_rx_buff = NULL;
+    }
+    else
+    {
+        const _cyhal_audioss_queue_entry_t *entry = &obj->rx_queue[obj->rx_queue_head];
+        obj->async_rx_buff = entry->buff;
+        obj->async_rx_length = entry->length;
+        obj->rx_queue_head = (obj->rx_queue_head + 1u) % CYHAL_AUDIOSS_ASYNC_QUEUE_DEPTH;
+        obj->rx_queue_count--;
+        dequeued = true;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(dequeued)
+    {
+        /* As in _cyhal_audioss_read_async, only this block's interrupts are held off while the FIFO is drained */
+        uint32_t old_events = _cyhal_audioss_disable_events(obj, false);
+        if(CYHAL_ASYNC_SW == obj->async_mode)
+        {
+            _cyhal_audioss_read_async_until_empty(obj);
+            is_complete = (0u == obj->async_rx_length);
+        }
+        _cyhal_audioss_update_rx_trigger_level(obj);
+        _cyhal_audioss_restore_events(obj, false, old_events);
+    }
+
+    savedIntrStatus = cyhal_system_critical_section_enter();
+    _cyhal_audioss_update_enabled_events(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return is_complete;
+}
+#endif /* defined(_CYHAL_AUDIOSS_RX_ENABLED) */
+
+/* Handles one set of events and returns the completion events of queued buffers that were
+ * already finished when they were started, which still have to be reported */
+static uint32_t _cyhal_audioss_process_event_once(_cyhal_audioss_t *obj, uint32_t event)
 {
     if(0 != (event & (obj->interface->event_mask_empty | obj->interface->event_mask_half_empty)))
     {
@@ -2620,9 +3614,7 @@ static void _cyhal_audioss_process_event(_cyhal_audioss_t *obj, uint32_t event)
                     */
                    uint32_t old_events = _cyhal_audioss_disable_events(obj, false);
                    cyhal_system_critical_section_exit(savedIntrStatus);
-                   // Safe to cast away volatile here because we're calling read_until_empty from within
-                   // a critical section, so it should not change out from under us during this call
-                   _cyhal_audioss_read_until_empty(obj, (void**)(&obj->async_rx_buff), (size_t*)(&obj->async_rx_length));
+                   _cyhal_audioss_read_async_until_empty(obj);
                    // Re-enter the global critical section so that the exit below behaves correctly
                    savedIntrStatus = cyhal_system_critical_section_enter();
                    _cyhal_audioss_restore_events(obj, false, old_events);
@@ -2663,18 +3655,24 @@ static void _cyhal_audioss_process_event(_cyhal_audioss_t *obj, uint32_t event)
     }
 #endif /* defined(_CYHAL_AUDIOSS_RX_ENABLED) */
 
-    /* Mark async transfer as complete if we just finished one. */
-    if(0 != (event & obj->interface->event_tx_complete))
+    /* Mark async transfer as complete if we just finished one, or chain into the next queued
+     * buffer. Circular transfers only complete a period, so they stay pending until they are aborted. */
+    uint32_t chained_events = 0u;
+    if(0 != (event & obj->interface->event_tx_complete) && !obj->tx_circular)
     {
-        obj->async_tx_buff = NULL;
-        _cyhal_audioss_update_enabled_events(obj);
+        if(_cyhal_audioss_queue_next_tx(obj))
+        {
+            chained_events |= obj->interface->event_tx_complete;
+        }
     }
 
 #if defined(_CYHAL_AUDIOSS_RX_ENABLED)
-    if(0 != (event & obj->interface->event_rx_complete))
+    if(0 != (event & obj->interface->event_rx_complete) && !obj->rx_circular)
     {
-        obj->async_rx_buff = NULL;
-        _cyhal_audioss_update_enabled_events(obj);
+        if(_cyhal_audioss_queue_next_rx(obj))
+        {
+            chained_events |= obj->interface->event_rx_complete;
+        }
     }
 #endif /* defined(_CYHAL_AUDIOSS_RX_ENABLED) */
 
@@ -2682,6 +3680,17 @@ static void _cyhal_audioss_process_event(_cyhal_audioss_t *obj, uint32_t event)
     {
         obj->interface->invoke_user_callback(obj, event & obj->user_enabled_events);
     }
+
+    return chained_events;
+}
+
+static void _cyhal_audioss_process_event(_cyhal_audioss_t *obj, uint32_t event)
+{
+    // A queued buffer that fit entirely into the FIFO is already done too; report it separately
+    while(0u != event)
+    {
+        event = _cyhal_audioss_process_event_once(obj, event);
+    }
 }
 
 static bool _cyhal_audioss_pm_callback(cyhal_syspm_callback_state_t state, cyhal_syspm_callback_mode_t mode, void* callback_arg)
@@ -2772,6 +3781,329 @@ cy_rslt_t _cyhal_audioss_disable_output(_cyhal_audioss_t *obj, bool is_rx)
 #endif /* defined(_CYHAL_AUDIOSS_TRIGGERS_AVAILABLE) */
 }
 
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+// The DSP extension packs and saturates two 16-bit samples per instruction
+#define _CYHAL_AUDIOSS_CONVERT_USE_DSP
+#endif
+
+// Word accesses to sample buffers of other types. The buffers may be unaligned, and memcpy keeps
+// this free of aliasing issues; it compiles down to a single load or store.
+static inline uint32_t _cyhal_audioss_load_word(const void *src)
+{
+    uint32_t value;
+    memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+static inline void _cyhal_audioss_store_word(void *dst, uint32_t value)
+{
+    memcpy(dst, &value, sizeof(value));
+}
+
+static inline int32_t _cyhal_audioss_sign_extend_24(uint32_t value)
+{
+    return ((int32_t)(value << 8)) >> 8;
+}
+
+static inline int16_t _cyhal_audioss_saturate_16(int32_t value)
+{
+#if defined(_CYHAL_AUDIOSS_CONVERT_USE_DSP)
+    return (int16_t)__SSAT(value, 16);
+#else
+    return (value > INT16_MAX) ? INT16_MAX : ((value < INT16_MIN) ? INT16_MIN : (int16_t)value);
+#endif
+}
+
+void _cyhal_audioss_pack_24(uint8_t *dst, const int32_t *src, size_t count)
+{
+    // Four samples fill exactly three words
+    for(; count >= 4u; count -= 4u)
+    {
+        uint32_t s0 = (uint32_t)src[0] & 0xFFFFFFu;
+        uint32_t s1 = (uint32_t)src[1] & 0xFFFFFFu;
+        uint32_t s2 = (uint32_t)src[2] & 0xFFFFFFu;
+        uint32_t s3 = (uint32_t)src[3] & 0xFFFFFFu;
+        _cyhal_audioss_store_word(&dst[0], s0 | (s1 << 24));
+        _cyhal_audioss_store_word(&dst[4], (s1 >> 8) | (s2 << 16));
+        _cyhal_audioss_store_word(&dst[8], (s2 >> 16) | (s3 << 8));
+        dst += 12;
+        src += 4;
+    }
+    for(; count > 0u; --count)
+    {
+        uint32_t sample = (uint32_t)(*src);
+        dst[0] = (uint8_t)sample;
+        dst[1] = (uint8_t)(sample >> 8);
+        dst[2] = (uint8_t)(sample >> 16);
+        dst += 3;
+        ++src;
+    }
+}
+
+void _cyhal_audioss_unpack_24(int32_t *dst, const uint8_t *src, size_t count)
+{
+    for(; count >= 4u; count -= 4u)
+    {
+        uint32_t w0 = _cyhal_audioss_load_word(&src[0]);
+        uint32_t w1 = _cyhal_audioss_load_word(&src[4]);
+        uint32_t w2 = _cyhal_audioss_load_word(&src[8]);
+        dst[0] = _cyhal_audioss_sign_extend_24(w0);
+        dst[1] = _cyhal_audioss_sign_extend_24((w0 >> 24) | (w1 << 8));
+        dst[2] = _cyhal_audioss_sign_extend_24((w1 >> 16) | (w2 << 16));
+        dst[3] = _cyhal_audioss_sign_extend_24(w2 >> 8);
+        dst += 4;
+        src += 12;
+    }
+    for(; count > 0u; --count)
+    {
+        *dst = _cyhal_audioss_sign_extend_24((uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16));
+        ++dst;
+        src += 3;
+    }
+}
+
+void _cyhal_audioss_convert_16_to_32(int32_t *dst, const int16_t *src, size_t count, uint8_t shift)
+{
+    CY_ASSERT(shift <= 16u);
+    for(; count >= 2u; count -= 2u)
+    {
+        // Both samples are fetched with one load and sign extended in place
+        uint32_t pair = _cyhal_audioss_load_word(src);
+        dst[0] = (int32_t)(((uint32_t)(((int32_t)(pair << 16)) >> 16)) << shift);
+        dst[1] = (int32_t)(((uint32_t)(((int32_t)pair) >> 16)) << shift);
+        dst += 2;
+        src += 2;
+    }
+    if(count > 0u)
+    {
+        *dst = (int32_t)(((uint32_t)(int32_t)(*src)) << shift);
+    }
+}
+
+void _cyhal_audioss_convert_32_to_16(int16_t *dst, const int32_t *src, size_t count, uint8_t shift)
+{
+    CY_ASSERT(shift <= 31u);
+#if defined(_CYHAL_AUDIOSS_CONVERT_USE_DSP)
+    for(; count >= 2u; count -= 2u)
+    {
+        uint32_t lo = (uint32_t)__SSAT(src[0] >> shift, 16);
+        uint32_t hi = (uint32_t)__SSAT(src[1] >> shift, 16);
+        _cyhal_audioss_store_word(dst, __PKHBT(lo, hi, 16));
+        dst += 2;
+        src += 2;
+    }
+#endif
+    for(; count > 0u; --count)
+    {
+        *dst = _cyhal_audioss_saturate_16(*src >> shift);
+        ++dst;
+        ++src;
+    }
+}
+
+void _cyhal_audioss_interleave_16(int16_t *dst, const int16_t *left, const int16_t *right, size_t frames)
+{
+#if defined(_CYHAL_AUDIOSS_CONVERT_USE_DSP)
+    for(; frames >= 2u; frames -= 2u)
+    {
+        uint32_t l = _cyhal_audioss_load_word(left);
+        uint32_t r = _cyhal_audioss_load_word(right);
+        _cyhal_audioss_store_word(&dst[0], __PKHBT(l, r, 16));
+        _cyhal_audioss_store_word(&dst[2], __PKHTB(r, l, 16));
+        dst += 4;
+        left += 2;
+        right += 2;
+    }
+#endif
+    for(; frames > 0u; --frames)
+    {
+        dst[0] = *left;
+        dst[1] = *right;
+        dst += 2;
+        ++left;
+        ++right;
+    }
+}
+
+void _cyhal_audioss_deinterleave_16(int16_t *left, int16_t *right, const int16_t *src, size_t frames)
+{
+#if defined(_CYHAL_AUDIOSS_CONVERT_USE_DSP)
+    for(; frames >= 2u; frames -= 2u)
+    {
+        uint32_t f0 = _cyhal_audioss_load_word(&src[0]);
+        uint32_t f1 = _cyhal_audioss_load_word(&src[2]);
+        _cyhal_audioss_store_word(left, __PKHBT(f0, f1, 16));
+        _cyhal_audioss_store_word(right, __PKHTB(f1, f0, 16));
+        src += 4;
+        left += 2;
+        right += 2;
+    }
+#endif
+    for(; frames > 0u; --frames)
+    {
+        *left = src[0];
+        *right = src[1];
+        src += 2;
+        ++left;
+        ++right;
+    }
+}
+
+void _cyhal_audioss_interleave_32(int32_t *dst, const int32_t *left, const int32_t *right, size_t frames)
+{
+    for(; frames >= 2u; frames -= 2u)
+    {
+        dst[0] = left[0];
+        dst[1] = right[0];
+        dst[2] = left[1];
+        dst[3] = right[1];
+        dst += 4;
+        left += 2;
+        right += 2;
+    }
+    if(frames > 0u)
+    {
+        dst[0] = *left;
+        dst[1] = *right;
+    }
+}
+
+void _cyhal_audioss_deinterleave_32(int32_t *left, int32_t *right, const int32_t *src, size_t frames)
+{
+    for(; frames >= 2u; frames -= 2u)
+    {
+        left[0] = src[0];
+        right[0] = src[1];
+        left[1] = src[2];
+        right[1] = src[3];
+        src += 4;
+        left += 2;
+        right += 2;
+    }
+    if(frames > 0u)
+    {
+        *left = src[0];
+        *right = src[1];
+    }
+}
+
+// The sample rate converter linearly interpolates each output frame between the two input frames
+// around it. Positions are kept in Q2.30 input frames, which resolves the ratio to about 1 ppb.
+#define _CYHAL_AUDIOSS_SRC_ONE          ((uint32_t)1u << 30)
+
+void _cyhal_audioss_src_init(_cyhal_audioss_src_t *src, uint8_t num_channels)
+{
+    CY_ASSERT(NULL != src);
+    CY_ASSERT((0u < num_channels) && (num_channels <= CYHAL_AUDIOSS_SRC_MAX_CHANNELS));
+    memset(src, 0, sizeof(_cyhal_audioss_src_t));
+    src->step = _CYHAL_AUDIOSS_SRC_ONE;
+    // Start on the first input frame, so that a ratio of 1 passes the input through unchanged
+    src->phase = _CYHAL_AUDIOSS_SRC_ONE;
+    src->num_channels = num_channels;
+}
+
+void _cyhal_audioss_src_set_ratio(_cyhal_audioss_src_t *src, uint32_t in_rate_millihz, uint32_t out_rate_millihz)
+{
+    CY_ASSERT(NULL != src);
+    CY_ASSERT(0u != out_rate_millihz);
+    // The step is limited to [0.5, 2] so that phase + step always fits in 32 bits
+    uint64_t step = ((uint64_t)in_rate_millihz << 30) / out_rate_millihz;
+    if (step < (_CYHAL_AUDIOSS_SRC_ONE / 2u))
+    {
+        step = _CYHAL_AUDIOSS_SRC_ONE / 2u;
+    }
+    else if (step > (2u * (uint64_t)_CYHAL_AUDIOSS_SRC_ONE))
+    {
+        step = 2u * (uint64_t)_CYHAL_AUDIOSS_SRC_ONE;
+    }
+    // Changing the step between two calls is glitch free, the phase carries over
+    src->step = (uint32_t)step;
+}
+
+size_t _cyhal_audioss_src_process_16(_cyhal_audioss_src_t *src, int16_t *dst, size_t dst_frames, const int16_t *in, size_t *in_frames)
+{
+    CY_ASSERT(NULL != src);
+    CY_ASSERT(NULL != in_frames);
+    const uint8_t channels = src->num_channels;
+    uint32_t phase = src->phase;
+    size_t consumed = 0u;
+    size_t produced = 0u;
+
+    while (produced < dst_frames)
+    {
+        // Move prev and the current input frame up to the position of the next output frame
+        while ((phase >= _CYHAL_AUDIOSS_SRC_ONE) && (consumed < *in_frames))
+        {
+            for (uint8_t ch = 0u; ch < channels; ++ch)
+            {
+                src->prev[ch] = in[ch];
+            }
+            in += channels;
+            ++consumed;
+            phase -= _CYHAL_AUDIOSS_SRC_ONE;
+        }
+        if ((phase >= _CYHAL_AUDIOSS_SRC_ONE) || (consumed == *in_frames))
+        {
+            break;
+        }
+        // Linear interpolation between prev and the current input frame. The difference of two
+        // 16-bit samples times a 15-bit fraction fits in 32 bits.
+        int32_t frac = (int32_t)(phase >> 15);
+        for (uint8_t ch = 0u; ch < channels; ++ch)
+        {
+            int32_t prev = src->prev[ch];
+            dst[ch] = (int16_t)(prev + (((in[ch] - prev) * frac) >> 15));
+        }
+        dst += channels;
+        ++produced;
+        phase += src->step;
+    }
+
+    src->phase = phase;
+    *in_frames = consumed;
+    return produced;
+}
+
+size_t _cyhal_audioss_src_process_32(_cyhal_audioss_src_t *src, int32_t *dst, size_t dst_frames, const int32_t *in, size_t *in_frames)
+{
+    CY_ASSERT(NULL != src);
+    CY_ASSERT(NULL != in_frames);
+    const uint8_t channels = src->num_channels;
+    uint32_t phase = src->phase;
+    size_t consumed = 0u;
+    size_t produced = 0u;
+
+    while (produced < dst_frames)
+    {
+        while ((phase >= _CYHAL_AUDIOSS_SRC_ONE) && (consumed < *in_frames))
+        {
+            for (uint8_t ch = 0u; ch < channels; ++ch)
+            {
+                src->prev[ch] = in[ch];
+            }
+            in += channels;
+            ++consumed;
+            phase -= _CYHAL_AUDIOSS_SRC_ONE;
+        }
+        if ((phase >= _CYHAL_AUDIOSS_SRC_ONE) || (consumed == *in_frames))
+        {
+            break;
+        }
+        int64_t frac = (int64_t)phase;
+        for (uint8_t ch = 0u; ch < channels; ++ch)
+        {
+            int64_t prev = src->prev[ch];
+            dst[ch] = (int32_t)(prev + ((((int64_t)in[ch] - prev) * frac) >> 30));
+        }
+        dst += channels;
+        ++produced;
+        phase += src->step;
+    }
+
+    src->phase = phase;
+    *in_frames = consumed;
+    return produced;
+}
 
 #if defined(__cplusplus)
 }
@@ -27,6 +27,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string.h>
 #include "cy_utils.h"
 #include "cyhal_dma.h"
 #include "cyhal_system.h"
@@ -47,10 +48,208 @@ extern "C" {
 #define _CYHAL_DMA_CHANNELS             8
 #define _CYHAL_DMA_MAX_LENGTH           (1 << 12u) /* sizeof(BTSS_DMAC_CONTROL_REG_t.bitfieds.length))*/
 #define _CYHAL_DMA_REQ_ERR_STATUS_BIT   (1 << 0u)  /* BTSS_DMAC_APP_REQUEST_t.errStatus : 1 */
+/* Largest automatic burst for each kind of endpoint: half of the peripheral FIFO, so that a burst
+ * always fits once the FIFO trigger fires at its default half-way level. */
+#define _CYHAL_DMA_AUTO_BURST_MAX_MEM   (256u)
+#define _CYHAL_DMA_AUTO_BURST_MAX_TDM   (64u)      /* 128 entry MXTDM FIFO */
+#define _CYHAL_DMA_AUTO_BURST_MAX_SCB   (CY_SCB_FIFO_SIZE / 2u)
 
 /* Internal tracking of DMA objects */
 static bool _cyhal_dma_arrays_initialized = false;
 CY_NOINIT static cyhal_dma_t *_cyhal_dma_obj[_CYHAL_DMA_CHANNELS];
+/* Per physical channel transfer queue. Several objects may target the same channel (eg: all SCBs
+ * share the memory-peripheral channels), so only one request is handed to the DMAC at a time and
+ * the others wait here in submission order. */
+CY_NOINIT static cyhal_dma_t *_cyhal_dma_ch_active[_CYHAL_DMA_CHANNELS];
+CY_NOINIT static cyhal_dma_t *_cyhal_dma_ch_queue[_CYHAL_DMA_CHANNELS];
+
+#if defined(CYHAL_DMA_STATS_ENABLED)
+#if !defined(CYHAL_DMA_STATS_GET_TICKS)
+/* Default to the CPU cycle counter, which is enabled the first time a DMA object is initialized */
+#define CYHAL_DMA_STATS_GET_TICKS()     (DWT->CYCCNT)
+#define _CYHAL_DMA_STATS_USE_DWT
+#endif
+
+/* Per physical channel transfer statistics */
+static cyhal_dma_stats_t _cyhal_dma_stats[_CYHAL_DMA_CHANNELS];
+
+/* Records that the request has been handed to the DMAC. Must be called from within a critical section. */
+static void _cyhal_dma_stats_started(cyhal_dma_t *obj)
+{
+    cyhal_dma_stats_t *stats = &_cyhal_dma_stats[obj->dma_req.channel];
+    obj->stats_start_ticks = CYHAL_DMA_STATS_GET_TICKS();
+    uint32_t wait = obj->stats_start_ticks - obj->stats_submit_ticks;
+    stats->queue_wait_ticks += wait;
+    if (wait > stats->queue_wait_max_ticks)
+    {
+        stats->queue_wait_max_ticks = wait;
+    }
+}
+
+/* Records the completion of the request. Must be called from within a critical section. */
+static void _cyhal_dma_stats_completed(cyhal_dma_t *obj, bool is_error)
+{
+    cyhal_dma_stats_t *stats = &_cyhal_dma_stats[obj->dma_req.channel];
+    uint32_t now = CYHAL_DMA_STATS_GET_TICKS();
+    uint32_t latency = now - obj->stats_start_ticks;
+    stats->latency_ticks += latency;
+    if (latency > stats->latency_max_ticks)
+    {
+        stats->latency_max_ticks = latency;
+    }
+    if (is_error)
+    {
+        stats->errors++;
+    }
+    else
+    {
+        stats->transfers++;
+        stats->bytes += obj->stats_bytes;
+    }
+    // A circular transfer carries on with its next segment straight away
+    obj->stats_start_ticks = now;
+}
+#endif /* defined(CYHAL_DMA_STATS_ENABLED) */
+
+
+static bool _cyhal_dma_req_in_progress(cyhal_dma_t *obj)
+{
+    BTSS_DMAC_REQ_STATUS_t status = btss_dmac_dmaReqGetStatus(&(obj->dma_req));
+    return ((status == BTSS_DMA_REQ_STATUS_IN_PROGRESS) || (status == BTSS_DMA_REQ_STATUS_WAITING_IN_QUEUE));
+}
+
+/* Hands the request to the DMAC if its channel is free, or queues it behind the requests of the same
+ * or higher priority. Returns false if the DMAC refused the request. Must be called from within a
+ * critical section. */
+static bool _cyhal_dma_submit(cyhal_dma_t *obj)
+{
+    uint8_t channel = obj->dma_req.channel;
+    bool status = true;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+    obj->stats_submit_ticks = CYHAL_DMA_STATS_GET_TICKS();
+#endif
+    if ((_cyhal_dma_ch_active[channel] == NULL) && (_cyhal_dma_ch_queue[channel] == NULL))
+    {
+        status = btss_dmac_requestTransfer(&(obj->dma_req));
+        if (status)
+        {
+            obj->lli_started = true;
+            _cyhal_dma_ch_active[channel] = obj;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+            _cyhal_dma_stats_started(obj);
+#endif
+        }
+    }
+    else
+    {
+        cyhal_dma_t **link = &_cyhal_dma_ch_queue[channel];
+        while ((*link != NULL) && ((*link)->priority <= obj->priority))
+        {
+            link = &((*link)->queue_next);
+        }
+        obj->queue_next = *link;
+        obj->is_queued = true;
+        obj->lli_started = true;
+        *link = obj;
+    }
+    return status;
+}
+
+/* Starts the request linked to one that has just been handed to the DMAC. Returns the linked
+ * request if the DMAC refused it, or NULL. Must be called from within a critical section. */
+static cyhal_dma_t *_cyhal_dma_start_linked(cyhal_dma_t *obj)
+{
+    cyhal_dma_t *linked = obj->start_linked;
+    if ((linked != NULL) && (linked->dma_req.channel < _CYHAL_DMA_CHANNELS) && !_cyhal_dma_submit(linked))
+    {
+        return linked;
+    }
+    return NULL;
+}
+
+/* Hands the channel over to the next queued request once the active one has finished. Returns a
+ * request that the DMAC refused to start, which has been removed from the queue and still has to
+ * be reported with _cyhal_dma_report_failed, or NULL. Must be called from within a critical section. */
+static cyhal_dma_t *_cyhal_dma_service_channel(uint8_t channel)
+{
+    if ((_cyhal_dma_ch_active[channel] != NULL) && !_cyhal_dma_req_in_progress(_cyhal_dma_ch_active[channel]))
+    {
+        _cyhal_dma_ch_active[channel] = NULL;
+    }
+
+    while ((_cyhal_dma_ch_active[channel] == NULL) && (_cyhal_dma_ch_queue[channel] != NULL))
+    {
+        cyhal_dma_t *next = _cyhal_dma_ch_queue[channel];
+        _cyhal_dma_ch_queue[channel] = next->queue_next;
+        next->queue_next = NULL;
+        next->is_queued = false;
+
+        if (btss_dmac_requestTransfer(&(next->dma_req)))
+        {
+            _cyhal_dma_ch_active[channel] = next;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+            _cyhal_dma_stats_started(next);
+#endif
+            cyhal_dma_t *linked_failed = _cyhal_dma_start_linked(next);
+            if (linked_failed != NULL)
+            {
+                return linked_failed;
+            }
+        }
+        else
+        {
+            return next;
+        }
+    }
+    return NULL;
+}
+
+/* Reports a request that the DMAC refused to start, then carries on servicing the channel until
+ * a request has been started or the queue is empty. Must be called outside of a critical section,
+ * so that the callbacks do not run with interrupts disabled. */
+static void _cyhal_dma_report_failed(uint8_t channel, cyhal_dma_t *failed)
+{
+    while (failed != NULL)
+    {
+        if (failed->callback_data.callback != NULL)
+        {
+            ((cyhal_dma_event_callback_t)failed->callback_data.callback)(failed->callback_data.callback_arg, CYHAL_DMA_GENERIC_ERROR);
+        }
+        uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+        failed = _cyhal_dma_service_channel(channel);
+        cyhal_system_critical_section_exit(saved_intr_status);
+    }
+}
+
+/* Removes the request from its channel queue, or releases the channel if the request owns it.
+ * Must be called from within a critical section. */
+static void _cyhal_dma_dequeue(cyhal_dma_t *obj)
+{
+    uint8_t channel = obj->dma_req.channel;
+    if (channel >= _CYHAL_DMA_CHANNELS)
+    {
+        return;
+    }
+
+    if (obj->is_queued)
+    {
+        cyhal_dma_t **link = &_cyhal_dma_ch_queue[channel];
+        while ((*link != NULL) && (*link != obj))
+        {
+            link = &((*link)->queue_next);
+        }
+        if (*link == obj)
+        {
+            *link = obj->queue_next;
+        }
+        obj->queue_next = NULL;
+        obj->is_queued = false;
+    }
+    else if (_cyhal_dma_ch_active[channel] == obj)
+    {
+        _cyhal_dma_ch_active[channel] = NULL;
+    }
+}
 
 
 /*******************************************************************************
@@ -123,6 +322,24 @@ void _cyhal_dma_event_handler(void *obj)
     cyhal_dma_event_t event;
     if (obj != NULL)
     {
+        // Start the next request waiting for this channel. A circular transfer keeps running after
+        // each segment so it holds on to the channel until it is disabled, even if the owner has
+        // since broken the ring to let it run out.
+        cyhal_dma_t *dma = (cyhal_dma_t *)obj;
+        if ((dma->dma_req.channel < _CYHAL_DMA_CHANNELS) && !dma->is_circular)
+        {
+            uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+            // The linked list items are only guaranteed to be valid until the transfer completes
+            dma->lli_tail = NULL;
+            if (_cyhal_dma_ch_active[dma->dma_req.channel] == dma)
+            {
+                _cyhal_dma_ch_active[dma->dma_req.channel] = NULL;
+            }
+            cyhal_dma_t *failed = _cyhal_dma_service_channel(dma->dma_req.channel);
+            cyhal_system_critical_section_exit(saved_intr_status);
+            _cyhal_dma_report_failed(dma->dma_req.channel, failed);
+        }
+
         callback = (cyhal_dma_event_callback_t)(((cyhal_dma_t *)obj)->callback_data.callback);
         //Check if the DMA error status bit is set.
         if( ((cyhal_dma_t *)obj)->dma_req.errStatus )
@@ -135,7 +352,17 @@ void _cyhal_dma_event_handler(void *obj)
         {
             event = CYHAL_DMA_TRANSFER_COMPLETE;
         }
-        if(callback != NULL)
+#if defined(CYHAL_DMA_STATS_ENABLED)
+        if (dma->dma_req.channel < _CYHAL_DMA_CHANNELS)
+        {
+            uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+            _cyhal_dma_stats_completed(dma, (event == CYHAL_DMA_GENERIC_ERROR));
+            cyhal_system_critical_section_exit(saved_intr_status);
+        }
+#endif
+        // The completion interrupt of a non-circular transfer is always raised so that the channel is
+        // handed over; only pass it on if the event has been enabled
+        if((callback != NULL) && ((event != CYHAL_DMA_TRANSFER_COMPLETE) || dma->int_enabled))
         {
             (callback)(((cyhal_dma_t *)obj)->callback_data.callback_arg, event);
         }
@@ -150,7 +377,6 @@ void _cyhal_dma_event_handler(void *obj)
 cy_rslt_t cyhal_dma_init_adv(cyhal_dma_t *obj, cyhal_dma_src_t *src, cyhal_dma_dest_t *dest,
                             cyhal_source_t *dest_source, uint8_t priority, cyhal_dma_direction_t direction)
 {
-    CY_UNUSED_PARAMETER(priority);
     CY_ASSERT(NULL != obj);
 
     if (!_cyhal_dma_arrays_initialized)
@@ -158,7 +384,16 @@ cy_rslt_t cyhal_dma_init_adv(cyhal_dma_t *obj, cyhal_dma_src_t *src, cyhal_dma_d
         for (uint8_t i = 0; i < _CYHAL_DMA_CHANNELS; i++)
         {
             _cyhal_dma_obj[i] = NULL;
+            _cyhal_dma_ch_active[i] = NULL;
+            _cyhal_dma_ch_queue[i] = NULL;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+            memset(&_cyhal_dma_stats[i], 0, sizeof(cyhal_dma_stats_t));
+#endif
         }
+#if defined(_CYHAL_DMA_STATS_USE_DWT)
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
         _cyhal_dma_arrays_initialized = true;
     }
 
@@ -248,6 +483,8 @@ cy_rslt_t cyhal_dma_init_adv(cyhal_dma_t *obj, cyhal_dma_src_t *src, cyhal_dma_d
         obj->resource.block_num = rscObj.block_num;
         obj->resource.channel_num = rscObj.channel_num;
         obj->is_enabled = false;
+        // Any level below CYHAL_DMA_PRIORITY_LOW is treated as the lowest priority
+        obj->priority = (priority > CYHAL_DMA_PRIORITY_LOW) ? CYHAL_DMA_PRIORITY_LOW : priority;
         obj->transfer_type = transfer_type;
         obj->src_ctrl = src_trigger;
         obj->dest_ctrl = dest_trigger;
@@ -262,6 +499,20 @@ cy_rslt_t cyhal_dma_init_adv(cyhal_dma_t *obj, cyhal_dma_src_t *src, cyhal_dma_d
         obj->dma_req.DMACCxConfiguration = 0;
         obj->dma_req.msg.next = NULL;
         obj->dma_req.msg.code = 0;
+        obj->lli_tail = NULL;
+        obj->lli_started = false;
+        obj->int_enabled = false;
+        obj->is_circular = false;
+        obj->is_queued = false;
+        obj->queue_next = NULL;
+        obj->start_linked = NULL;
+        obj->copy_head = NULL;
+        obj->copy_tail = NULL;
+#if defined(CYHAL_DMA_STATS_ENABLED)
+        obj->stats_bytes = 0u;
+        obj->stats_submit_ticks = 0u;
+        obj->stats_start_ticks = 0u;
+#endif
         obj->callback_data.callback = NULL;
         obj->callback_data.callback_arg = NULL;
 
@@ -277,7 +528,7 @@ cy_rslt_t cyhal_dma_init_adv(cyhal_dma_t *obj, cyhal_dma_src_t *src, cyhal_dma_d
             _cyhal_syspm_register_peripheral_callback(&_cyhal_dma_syspm_callback_data);
         }
 
-        _cyhal_dma_obj[channel] = obj;
+        _cyhal_dma_obj[obj->resource.channel_num] = obj;
     }
 
     return rslt;
@@ -297,6 +548,16 @@ void cyhal_dma_free(cyhal_dma_t *obj)
     CY_ASSERT(!cyhal_dma_is_busy(obj));
     CY_ASSERT(_cyhal_dma_arrays_initialized); /* Should not be freeing if we never initialized anything */
 
+    uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+    _cyhal_dma_dequeue(obj);
+    cyhal_dma_t *failed = NULL;
+    if (obj->dma_req.channel < _CYHAL_DMA_CHANNELS)
+    {
+        failed = _cyhal_dma_service_channel(obj->dma_req.channel);
+    }
+    cyhal_system_critical_section_exit(saved_intr_status);
+    _cyhal_dma_report_failed(obj->dma_req.channel, failed);
+
     _cyhal_dma_obj[obj->resource.channel_num] = NULL;
 
     if (!_cyhal_dma_pm_has_enabled())
@@ -307,119 +568,153 @@ void cyhal_dma_free(cyhal_dma_t *obj)
     cyhal_hwmgr_free(&obj->resource);
 }
 
-cy_rslt_t cyhal_dma_configure(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg)
+static void _cyhal_dma_allocate_channel(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg)
 {
-    CY_ASSERT(NULL != obj);
-    CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
-
-    cy_rslt_t status = CY_RSLT_SUCCESS;
-    uint32_t data_width;
-    uint32_t burst_size;
+    uint8_t channel = _CYHAL_DMA_CH_NOT_ALLOCATED;
+    BTSS_DMAC_CONTROL_LINE_t src_trigger = _CYHAL_DMAC_CONTROL_LINE_NONE;
+    BTSS_DMAC_CONTROL_LINE_t dest_trigger = _CYHAL_DMAC_CONTROL_LINE_NONE;
 
-    if ((cfg->action == CYHAL_DMA_TRANSFER_BURST)
-        || (cfg->action == CYHAL_DMA_TRANSFER_BURST_DISABLE)
-        || (cfg->action == CYHAL_DMA_TRANSFER_FULL_DISABLE))
+    // Memory to peripheral path
+    if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SRAM_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SRAM_END))
     {
-        status = CYHAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE; // Unsupported actions
-    }
+        channel = _CYHAL_DMA_CH_MEM_TO_MEM;
+        src_trigger = _CYHAL_DMAC_CONTROL_LINE_M2M;
 
-    if (cfg->length >= _CYHAL_DMA_MAX_LENGTH)
-    {
-        status = CYHAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
+        if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB0_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB0_END))
+        {
+            channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
+            dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB0;
+        }
+        else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB1_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB1_END))
+        {
+            channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
+            dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB1;
+        }
+        else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB2_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB2_END))
+        {
+            channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
+            dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB2;
+        }
+        else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_TDM0_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_TDM0_END))
+        {
+            channel = _CYHAL_DMA_CH_MEM_TO_TDM0;
+            dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_MXTDM0;
+        }
+        else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_TDM1_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_TDM1_END))
+        {
+            channel = _CYHAL_DMA_CH_MEM_TO_TDM1;
+            dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_MXTDM1;
+        }
+        else
+        {
+            /* Either unsupported peripheral or an M2M transfer */
+        }
     }
 
-    // Allocate channel info based on source and destination addresses
-    if (obj->dma_req.channel == _CYHAL_DMA_CH_NOT_ALLOCATED)
+    // Peripheral to memory path
+    if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SRAM_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SRAM_END))
     {
-        uint8_t channel = _CYHAL_DMA_CH_NOT_ALLOCATED;
-        BTSS_DMAC_CONTROL_LINE_t src_trigger = _CYHAL_DMAC_CONTROL_LINE_NONE;
-        BTSS_DMAC_CONTROL_LINE_t dest_trigger = _CYHAL_DMAC_CONTROL_LINE_NONE;
+        channel = _CYHAL_DMA_CH_MEM_TO_MEM;
+        dest_trigger = _CYHAL_DMAC_CONTROL_LINE_M2M;
 
-        // Memory to peripheral path
-        if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SRAM_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SRAM_END))
+        if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB0_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB0_END))
         {
-            channel = _CYHAL_DMA_CH_MEM_TO_MEM;
-            src_trigger = _CYHAL_DMAC_CONTROL_LINE_M2M;
-
-            if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB0_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB0_END))
-            {
-                channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
-                dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB0;
-            }
-            else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB1_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB1_END))
-            {
-                channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
-                dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB1;
-            }
-            else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SCB2_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SCB2_END))
-            {
-                channel = _CYHAL_DMA_CH_MEM_TO_PERIPH;
-                dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_SCB2;
-            }
-            else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_TDM0_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_TDM0_END))
-            {
-                channel = _CYHAL_DMA_CH_MEM_TO_TDM0;
-                dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_MXTDM0;
-            }
-            else if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_TDM1_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_TDM1_END))
-            {
-                channel = _CYHAL_DMA_CH_MEM_TO_TDM1;
-                dest_trigger = BTSS_DMAC_CONTROL_LINE_DST_MXTDM1;
-            }
-            else
-            {
-                /* Either unsupported peripheral or an M2M transfer */
-            }
+            channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
+            src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB0;
         }
-
-        // Peripheral to memory path
-        if ((cfg->dst_addr >= _CYHAL_DMA_ADDR_SRAM_START) && (cfg->dst_addr < _CYHAL_DMA_ADDR_SRAM_END))
+        else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB1_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB1_END))
         {
-            channel = _CYHAL_DMA_CH_MEM_TO_MEM;
-            dest_trigger = _CYHAL_DMAC_CONTROL_LINE_M2M;
-
-            if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB0_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB0_END))
-            {
-                channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
-                src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB0;
-            }
-            else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB1_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB1_END))
-            {
-                channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
-                src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB1;
-            }
-            else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB2_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB2_END))
-            {
-                channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
-                src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB2;
-            }
-            else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_TDM0_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_TDM0_END))
-            {
-                channel = _CYHAL_DMA_CH_TDM0_TO_MEM;
-                src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_MXTDM0;
-            }
-            else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_TDM1_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_TDM1_END))
-            {
-                channel = _CYHAL_DMA_CH_TDM1_TO_MEM;
-                src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_MXTDM1;
-            }
-            else
-            {
-                /* Either unsupported peripheral or an M2M transfer */
-            }
+            channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
+            src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB1;
+        }
+        else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_SCB2_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_SCB2_END))
+        {
+            channel = _CYHAL_DMA_CH_PERIPH_TO_MEM;
+            src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_SCB2;
+        }
+        else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_TDM0_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_TDM0_END))
+        {
+            channel = _CYHAL_DMA_CH_TDM0_TO_MEM;
+            src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_MXTDM0;
+        }
+        else if ((cfg->src_addr >= _CYHAL_DMA_ADDR_TDM1_START) && (cfg->src_addr < _CYHAL_DMA_ADDR_TDM1_END))
+        {
+            channel = _CYHAL_DMA_CH_TDM1_TO_MEM;
+            src_trigger = BTSS_DMAC_CONTROL_LINE_SRC_MXTDM1;
+        }
+        else
+        {
+            /* Either unsupported peripheral or an M2M transfer */
         }
+    }
+
+    if (!((src_trigger == _CYHAL_DMAC_CONTROL_LINE_NONE) && (dest_trigger == _CYHAL_DMAC_CONTROL_LINE_NONE)))
+    {
+        obj->dma_req.channel = channel;
+        obj->src_ctrl = src_trigger;
+        obj->dest_ctrl = dest_trigger;
+    }
+}
+
+/* Returns the largest burst that the peripheral FIFO at either end of the transfer can accept */
+static uint32_t _cyhal_dma_auto_burst_limit(const cyhal_dma_t *obj)
+{
+    // Source and destination lines may share numbers, so check the peripheral end explicitly
+    if ((obj->src_ctrl == _CYHAL_DMAC_CONTROL_LINE_M2M) && (obj->dest_ctrl == _CYHAL_DMAC_CONTROL_LINE_M2M))
+    {
+        return _CYHAL_DMA_AUTO_BURST_MAX_MEM;
+    }
+    else if ((obj->src_ctrl == BTSS_DMAC_CONTROL_LINE_SRC_MXTDM0) || (obj->src_ctrl == BTSS_DMAC_CONTROL_LINE_SRC_MXTDM1)
+            || (obj->dest_ctrl == BTSS_DMAC_CONTROL_LINE_DST_MXTDM0) || (obj->dest_ctrl == BTSS_DMAC_CONTROL_LINE_DST_MXTDM1))
+    {
+        return _CYHAL_DMA_AUTO_BURST_MAX_TDM;
+    }
+    else
+    {
+        return _CYHAL_DMA_AUTO_BURST_MAX_SCB;
+    }
+}
 
-        if (!((src_trigger == _CYHAL_DMAC_CONTROL_LINE_NONE) && (dest_trigger == _CYHAL_DMAC_CONTROL_LINE_NONE)))
+/* Returns the largest supported burst size that is neither longer than the transfer nor the limit.
+ * If exact is set, the burst must also divide the transfer length: a peripheral source stops
+ * requesting once fewer elements than its trigger level are left in the FIFO, so a tail shorter
+ * than a burst would never be read. */
+static uint32_t _cyhal_dma_auto_burst_size(uint32_t length, uint32_t limit, bool exact)
+{
+    static const uint16_t burst_sizes[] = { 256u, 128u, 64u, 32u, 16u, 8u, 4u };
+    for (size_t i = 0; i < sizeof(burst_sizes) / sizeof(burst_sizes[0]); i++)
+    {
+        if ((burst_sizes[i] <= length) && (burst_sizes[i] <= limit)
+            && (!exact || ((length % burst_sizes[i]) == 0u)))
         {
-            obj->dma_req.channel = channel;
-            obj->src_ctrl = src_trigger;
-            obj->dest_ctrl = dest_trigger;
+            return burst_sizes[i];
         }
     }
+    return 1u;
+}
 
-    if (obj->dma_req.channel == _CYHAL_DMA_CH_NOT_ALLOCATED)
+/* Validates a single segment configuration and converts it into the DMACCxControl register
+ * format. Bits not related to the segment (eg: intEnable) are left untouched in ctrl_reg. */
+static cy_rslt_t _cyhal_dma_convert_cfg(const cyhal_dma_cfg_t *cfg, uint32_t burst_limit, bool burst_exact,
+                                       BTSS_DMAC_CONTROL_REG_t *ctrl_reg)
+{
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    uint32_t data_width = 0;
+    uint32_t burst_size = 0;
+    uint32_t requested_burst = (cfg->burst_size == CYHAL_DMA_BURST_SIZE_AUTO)
+        ? _cyhal_dma_auto_burst_size(cfg->length, burst_limit, burst_exact)
+        : cfg->burst_size;
+
+    if ((cfg->action == CYHAL_DMA_TRANSFER_BURST)
+        || (cfg->action == CYHAL_DMA_TRANSFER_BURST_DISABLE)
+        || (cfg->action == CYHAL_DMA_TRANSFER_FULL_DISABLE))
     {
-        status = CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER; // Couldn't find a valid channel
+        status = CYHAL_DMA_RSLT_FATAL_UNSUPPORTED_HARDWARE; // Unsupported actions
+    }
+
+    if (cfg->length >= _CYHAL_DMA_MAX_LENGTH)
+    {
+        status = CYHAL_DMA_RSLT_ERR_INVALID_TRANSFER_SIZE;
     }
 
     if (status == CY_RSLT_SUCCESS)
@@ -435,15 +730,15 @@ cy_rslt_t cyhal_dma_configure(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg)
 
     if (status == CY_RSLT_SUCCESS)
     {
-        burst_size = (cfg->burst_size == 0) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_1 : /* intentionally set to 1 */
-                    (cfg->burst_size == 1) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_1 :
-                    (cfg->burst_size == 4) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_4 :
-                    (cfg->burst_size == 8) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_8 :
-                    (cfg->burst_size == 16) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_16 :
-                    (cfg->burst_size == 32) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_32 :
-                    (cfg->burst_size == 64) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_64 :
-                    (cfg->burst_size == 128) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_128 :
-                    (cfg->burst_size == 256) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_256 :
+        burst_size = (requested_burst == 0) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_1 : /* intentionally set to 1 */
+                    (requested_burst == 1) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_1 :
+                    (requested_burst == 4) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_4 :
+                    (requested_burst == 8) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_8 :
+                    (requested_burst == 16) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_16 :
+                    (requested_burst == 32) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_32 :
+                    (requested_burst == 64) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_64 :
+                    (requested_burst == 128) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_128 :
+                    (requested_burst == 256) ? BTSS_DMAC_CONTROL_REG_BURST_SIZE_256 :
                     CYHAL_DMA_RSLT_ERR_INVALID_BURST_SIZE;
 
         status = (burst_size != CYHAL_DMA_RSLT_ERR_INVALID_BURST_SIZE) ?
@@ -452,55 +747,159 @@ cy_rslt_t cyhal_dma_configure(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg)
 
     if (status == CY_RSLT_SUCCESS)
     {
-        BTSS_DMAC_CONFIG_REG_t cfg_reg;
-        cfg_reg.u32 = (uint32_t)(obj->dma_req.DMACCxConfiguration);
-        cfg_reg.bitfields.srcDmaLine = obj->src_ctrl;
-        cfg_reg.bitfields.dstDmaLine = obj->dest_ctrl;
-        cfg_reg.bitfields.flowcontrol = obj->transfer_type;
-        // Potential ROM bug: errIntMask must be 1 for interrupts & transfers to work
-        // Set this back to 0 once resolved
-        cfg_reg.bitfields.errIntMask = 1;
+        ctrl_reg->bitfields.length = cfg->length;
+        ctrl_reg->bitfields.srcBurstSize = burst_size;
+        ctrl_reg->bitfields.dstBurstSize = burst_size;
+        ctrl_reg->bitfields.srcDataWidth = data_width;
+        ctrl_reg->bitfields.dstDataWidth = data_width;
+        ctrl_reg->bitfields.srcIncrement = cfg->src_increment;
+        ctrl_reg->bitfields.dstIncrement = cfg->dst_increment;
+    }
+
+    return status;
+}
 
-        BTSS_DMAC_CONTROL_REG_t ctrl_reg;
-        ctrl_reg.u32 = (uint32_t)(obj->dma_req.DMACCx_first_segment_regs.DMACCxControl);
-        ctrl_reg.bitfields.length = cfg->length;
-        ctrl_reg.bitfields.srcBurstSize = burst_size;
-        ctrl_reg.bitfields.dstBurstSize = burst_size;
-        ctrl_reg.bitfields.srcDataWidth = data_width;
-        ctrl_reg.bitfields.dstDataWidth = data_width;
-        ctrl_reg.bitfields.srcIncrement = cfg->src_increment;
-        ctrl_reg.bitfields.dstIncrement = cfg->dst_increment;
+/* Programs the first segment and the channel configuration into the DMA request. The linked list
+ * item is the head of the remaining segments, or NULL for a single segment transfer. */
+static void _cyhal_dma_apply_config(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, BTSS_DMAC_CONTROL_REG_t ctrl_reg,
+                                    cyhal_dma_lli_t *lli)
+{
+    BTSS_DMAC_CONFIG_REG_t cfg_reg;
+    cfg_reg.u32 = (uint32_t)(obj->dma_req.DMACCxConfiguration);
+    cfg_reg.bitfields.srcDmaLine = obj->src_ctrl;
+    cfg_reg.bitfields.dstDmaLine = obj->dest_ctrl;
+    cfg_reg.bitfields.flowcontrol = obj->transfer_type;
+    // Potential ROM bug: errIntMask must be 1 for interrupts & transfers to work
+    // Set this back to 0 once resolved
+    cfg_reg.bitfields.errIntMask = 1;
+    // The completion interrupt hands the channel over to the next queued request
+    cfg_reg.bitfields.tcIntMask = 1;
+
+    btss_dmac_dmaReqSetChannel(&(obj->dma_req), obj->dma_req.channel);
+    btss_dmac_dmaReqSetCallback(&(obj->dma_req), _cyhal_dma_event_handler, obj);
+    // Writes to DMACCx_first_segment_regs (channel is already set so skipping configuring that)
+    btss_dmac_dmaReqSetSrc(&(obj->dma_req), cfg->src_addr);
+    btss_dmac_dmaReqSetDst(&(obj->dma_req), cfg->dst_addr);
+    btss_dmac_dmaReqSetLLI(&(obj->dma_req), (void *)lli);
+
+    // Writes to DMACCx_first_segment_regs.DMACCxControl
+    btss_dmac_dmaReqSetControl(&(obj->dma_req), ctrl_reg);
 
-        btss_dmac_dmaReqSetChannel(&(obj->dma_req), obj->dma_req.channel);
-        // Writes to DMACCx_first_segment_regs (channel is already set so skipping configuring that)
-        btss_dmac_dmaReqSetSrc(&(obj->dma_req), cfg->src_addr);
-        btss_dmac_dmaReqSetDst(&(obj->dma_req), cfg->dst_addr);
-        btss_dmac_dmaReqSetLLI(&(obj->dma_req), NULL); // Linked list item currently not used
+    // Writes to DMACCxConfiguration
+    btss_dmac_dmaReqSetConfig(&(obj->dma_req), cfg_reg);
 
-        // Writes to DMACCx_first_segment_regs.DMACCxControl
-        btss_dmac_dmaReqSetControl(&(obj->dma_req), ctrl_reg);
+    if(obj->transfer_type == BTSS_DMAC_CONFIG_REG_FLOWCNTRL_MEMORY_TO_PERIPH_NO_FLOW)
+    {
+        btss_dmac_setPeripheralDMACSync(obj->dest_ctrl, true);
+    }
+    else if (obj->transfer_type == BTSS_DMAC_CONFIG_REG_FLOWCNTRL_PERIPH_TO_MEMORY_NO_FLOW)
+    {
+        btss_dmac_setPeripheralDMACSync(obj->src_ctrl, true);
+    }
+    else
+    {
+        btss_dmac_setPeripheralDMACSync(obj->src_ctrl, false);
+        btss_dmac_setPeripheralDMACSync(obj->dest_ctrl, false);
+    }
+}
 
-        // Writes to DMACCxConfiguration
-        btss_dmac_dmaReqSetConfig(&(obj->dma_req), cfg_reg);
+cy_rslt_t cyhal_dma_configure(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg)
+{
+    return cyhal_dma_configure_chain(obj, cfg, 1u, NULL);
+}
 
-        if(obj->transfer_type == BTSS_DMAC_CONFIG_REG_FLOWCNTRL_MEMORY_TO_PERIPH_NO_FLOW)
-        {
-            btss_dmac_setPeripheralDMACSync(obj->dest_ctrl, true);
-        }
-        else if (obj->transfer_type == BTSS_DMAC_CONFIG_REG_FLOWCNTRL_PERIPH_TO_MEMORY_NO_FLOW)
+/* Common implementation of chained and circular configurations. A chain of N segments uses N - 1
+ * linked list items and ends on the last one. A circular list uses N items, the last of which
+ * describes the first segment again and links back to the head of the list. */
+static cy_rslt_t _cyhal_dma_configure_lli(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, size_t num_segments,
+                                         cyhal_dma_lli_t *lli, bool circular)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != cfg);
+    CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
+
+    cy_rslt_t status = CY_RSLT_SUCCESS;
+    size_t num_items = circular ? num_segments : (num_segments - 1u);
+
+    if ((num_segments == 0u) || ((num_items > 0u) && (lli == NULL)))
+    {
+        status = CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+
+    // Allocate channel info based on source and destination addresses of the first segment.
+    // All segments of a chain are expected to target the same peripheral.
+    if ((status == CY_RSLT_SUCCESS) && (obj->dma_req.channel == _CYHAL_DMA_CH_NOT_ALLOCATED))
+    {
+        _cyhal_dma_allocate_channel(obj, &cfg[0]);
+    }
+
+    if (obj->dma_req.channel == _CYHAL_DMA_CH_NOT_ALLOCATED)
+    {
+        status = CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER; // Couldn't find a valid channel
+    }
+
+    BTSS_DMAC_CONTROL_REG_t ctrl_reg;
+    ctrl_reg.u32 = (uint32_t)(obj->dma_req.DMACCx_first_segment_regs.DMACCxControl);
+    // Only the last segment of a chain raises the completion interrupt, so the whole chain costs one
+    // interrupt. It is raised even if the event is disabled, to release the channel. A circular list
+    // never ends and never releases the channel, so every segment raises it if the event is enabled.
+    uint32_t int_enable = obj->int_enabled ? 1u : 0u;
+    uint32_t burst_limit = _cyhal_dma_auto_burst_limit(obj);
+    bool burst_exact = (obj->transfer_type == BTSS_DMAC_CONFIG_REG_FLOWCNTRL_PERIPH_TO_MEMORY_NO_FLOW);
+
+    if (status == CY_RSLT_SUCCESS)
+    {
+        status = _cyhal_dma_convert_cfg(&cfg[0], burst_limit, burst_exact, &ctrl_reg);
+        ctrl_reg.bitfields.intEnable = circular ? int_enable : ((num_items == 0u) ? 1u : 0u);
+    }
+
+    // Build the linked list items. lli[i - 1] describes cfg[i % num_segments].
+    for (size_t i = 1u; (status == CY_RSLT_SUCCESS) && (i <= num_items); i++)
+    {
+        const cyhal_dma_cfg_t *seg_cfg = &cfg[i % num_segments];
+        bool is_last = (i == num_items);
+        BTSS_DMAC_CONTROL_REG_t seg_ctrl;
+        seg_ctrl.u32 = ctrl_reg.u32;
+        status = _cyhal_dma_convert_cfg(seg_cfg, burst_limit, burst_exact, &seg_ctrl);
+        if (status == CY_RSLT_SUCCESS)
         {
-            btss_dmac_setPeripheralDMACSync(obj->src_ctrl, true);
+            seg_ctrl.bitfields.intEnable = circular ? int_enable : (is_last ? 1u : 0u);
+            lli[i - 1u].src_addr = seg_cfg->src_addr;
+            lli[i - 1u].dst_addr = seg_cfg->dst_addr;
+            lli[i - 1u].next = !is_last ? &lli[i] : (circular ? &lli[0] : NULL);
+            lli[i - 1u].control = seg_ctrl.u32;
         }
-        else
+    }
+
+    if (status == CY_RSLT_SUCCESS)
+    {
+#if defined(CYHAL_DMA_STATS_ENABLED)
+        // A circular transfer completes one segment at a time
+        obj->stats_bytes = 0u;
+        for (size_t i = 0u; i < (circular ? 1u : num_segments); i++)
         {
-            btss_dmac_setPeripheralDMACSync(obj->src_ctrl, false);
-            btss_dmac_setPeripheralDMACSync(obj->dest_ctrl, false);
+            obj->stats_bytes += cfg[i].length * (cfg[i].transfer_width / 8u);
         }
-   }
+#endif
+        obj->lli_tail = (num_items > 0u) ? &lli[num_items - 1u] : NULL;
+        obj->lli_started = false;
+        obj->is_circular = circular;
+        _cyhal_dma_apply_config(obj, &cfg[0], ctrl_reg, (num_items > 0u) ? &lli[0] : NULL);
+    }
 
     return status;
 }
 
+cy_rslt_t cyhal_dma_configure_chain(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, size_t num_segments, cyhal_dma_lli_t *lli)
+{
+    return _cyhal_dma_configure_lli(obj, cfg, num_segments, lli, false);
+}
+
+cy_rslt_t cyhal_dma_configure_circular(cyhal_dma_t *obj, const cyhal_dma_cfg_t *cfg, size_t num_segments, cyhal_dma_lli_t *lli)
+{
+    return _cyhal_dma_configure_lli(obj, cfg, num_segments, lli, true);
+}
+
 cy_rslt_t cyhal_dma_start_transfer(cyhal_dma_t *obj)
 {
     CY_ASSERT(NULL != obj);
@@ -517,7 +916,26 @@ cy_rslt_t cyhal_dma_start_transfer(cyhal_dma_t *obj)
         if (cyhal_dma_is_busy(obj))
             return CYHAL_DMA_RSLT_WARN_TRANSFER_ALREADY_STARTED;
 
-        status = btss_dmac_requestTransfer(&(obj->dma_req));
+        uint8_t channel = obj->dma_req.channel;
+        if (channel >= _CYHAL_DMA_CHANNELS)
+            return CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+
+        uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+        cyhal_dma_t *failed = _cyhal_dma_service_channel(channel);
+        // If the channel is owned by another object, the request waits in the queue
+        status = _cyhal_dma_submit(obj);
+        cyhal_dma_t *linked_failed = NULL;
+        if (status && (_cyhal_dma_ch_active[channel] == obj))
+        {
+            linked_failed = _cyhal_dma_start_linked(obj);
+        }
+        cyhal_system_critical_section_exit(saved_intr_status);
+        _cyhal_dma_report_failed(channel, failed);
+        if (linked_failed != NULL)
+        {
+            _cyhal_dma_report_failed(linked_failed->dma_req.channel, linked_failed);
+        }
+
         if(!status)
             return CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER;
     }
@@ -546,7 +964,25 @@ cy_rslt_t cyhal_dma_disable(cyhal_dma_t *obj)
     CY_ASSERT(NULL != obj);
     CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
 
-    btss_dmac_killTransfer(&(obj->dma_req));
+    uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+    bool was_active = !obj->is_queued;
+    _cyhal_dma_dequeue(obj);
+    if (was_active)
+    {
+        btss_dmac_killTransfer(&(obj->dma_req));
+    }
+    // A stopped transfer no longer uses the linked list items
+    if (obj->lli_started)
+    {
+        obj->lli_tail = NULL;
+    }
+    cyhal_dma_t *failed = NULL;
+    if (obj->dma_req.channel < _CYHAL_DMA_CHANNELS)
+    {
+        failed = _cyhal_dma_service_channel(obj->dma_req.channel);
+    }
+    cyhal_system_critical_section_exit(saved_intr_status);
+    _cyhal_dma_report_failed(obj->dma_req.channel, failed);
 
     // Disable DMA
     obj->is_enabled = false;
@@ -564,8 +1000,8 @@ bool cyhal_dma_is_busy(cyhal_dma_t *obj)
     CY_ASSERT(NULL != obj);
     CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
 
-    BTSS_DMAC_REQ_STATUS_t status = btss_dmac_dmaReqGetStatus(&(obj->dma_req));
-    return ((status == BTSS_DMA_REQ_STATUS_IN_PROGRESS) || (status == BTSS_DMA_REQ_STATUS_WAITING_IN_QUEUE));
+    // The channel is handed over from the completion interrupt, so this is a plain status query
+    return obj->is_queued || _cyhal_dma_req_in_progress(obj);
 }
 
 void cyhal_dma_register_callback(cyhal_dma_t *obj, cyhal_dma_event_callback_t callback, void *callback_arg)
@@ -609,12 +1045,263 @@ void cyhal_dma_enable_event(cyhal_dma_t *obj, cyhal_dma_event_t event, uint8_t i
         cfg_reg.bitfields.errIntMask = 1;
     }
 
-    ctrl_reg.bitfields.intEnable = enable ? 1 : 0;
+    obj->int_enabled = enable;
+
+    // The linked list items belong to the caller and may be gone once a started transfer has ended
+    if ((obj->lli_tail != NULL) && obj->lli_started && !cyhal_dma_is_busy(obj))
+    {
+        obj->lli_tail = NULL;
+    }
+
+    // The last segment of any other transfer always raises the completion interrupt to hand the
+    // channel over, and the event handler filters it out if the event is disabled. A circular list
+    // links the tail back to the head, and every segment raises the interrupt only if enabled.
+    if ((obj->lli_tail != NULL) && (obj->lli_tail->next != NULL))
+    {
+        cyhal_dma_lli_t *item = obj->lli_tail;
+        do
+        {
+            BTSS_DMAC_CONTROL_REG_t item_reg;
+            item_reg.u32 = item->control;
+            item_reg.bitfields.intEnable = enable ? 1 : 0;
+            item->control = item_reg.u32;
+            item = item->next;
+        } while (item != obj->lli_tail);
+
+        ctrl_reg.bitfields.intEnable = enable ? 1 : 0;
+    }
 
     btss_dmac_dmaReqSetConfig(&(obj->dma_req), cfg_reg);
     btss_dmac_dmaReqSetControl(&(obj->dma_req), ctrl_reg);
 }
 
+#if defined(CYHAL_DMA_STATS_ENABLED)
+cy_rslt_t cyhal_dma_get_stats(cyhal_dma_t *obj, cyhal_dma_stats_t *stats)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != stats);
+
+    if (obj->dma_req.channel >= _CYHAL_DMA_CHANNELS)
+    {
+        return CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+
+    uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+    *stats = _cyhal_dma_stats[obj->dma_req.channel];
+    cyhal_system_critical_section_exit(saved_intr_status);
+    return CY_RSLT_SUCCESS;
+}
+
+void cyhal_dma_clear_stats(cyhal_dma_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (obj->dma_req.channel < _CYHAL_DMA_CHANNELS)
+    {
+        uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+        memset(&_cyhal_dma_stats[obj->dma_req.channel], 0, sizeof(cyhal_dma_stats_t));
+        cyhal_system_critical_section_exit(saved_intr_status);
+    }
+}
+#endif /* defined(CYHAL_DMA_STATS_ENABLED) */
+
+/*******************************************************************************
+*       Memory copy
+*******************************************************************************/
+
+/* Programs the next chunk of the request at the head of the copy queue. The transfer width is the
+ * widest one that both addresses are aligned to; any unaligned tail is moved by a following chunk. */
+static cy_rslt_t _cyhal_dma_copy_start(cyhal_dma_t *obj)
+{
+    cyhal_dma_copy_t *req = obj->copy_head;
+    uint32_t align = req->dst_addr | (req->is_fill ? 0u : req->src_addr);
+    uint32_t width_bytes =
+        (((align & 3u) == 0u) && (req->remaining >= 4u)) ? 4u :
+        (((align & 1u) == 0u) && (req->remaining >= 2u)) ? 2u :
+        1u;
+    size_t length = req->remaining / width_bytes;
+    if (length > (_CYHAL_DMA_MAX_LENGTH - 1u))
+    {
+        length = _CYHAL_DMA_MAX_LENGTH - 1u;
+    }
+    req->chunk = length * width_bytes;
+
+    cyhal_dma_cfg_t dma_cfg =
+    {
+        .src_addr = req->is_fill ? (uint32_t)&(req->fill) : req->src_addr,
+        .src_increment = req->is_fill ? 0 : 1,
+        .dst_addr = req->dst_addr,
+        .dst_increment = 1,
+        .transfer_width = width_bytes * 8u,
+        .length = length,
+        .burst_size = CYHAL_DMA_BURST_SIZE_AUTO,
+        .action = CYHAL_DMA_TRANSFER_FULL,
+    };
+
+    cy_rslt_t result = cyhal_dma_configure(obj, &dma_cfg);
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_dma_enable_event(obj, CYHAL_DMA_TRANSFER_COMPLETE, CYHAL_ISR_PRIORITY_DEFAULT, true);
+        result = cyhal_dma_enable(obj);
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_dma_start_transfer(obj);
+    }
+    return result;
+}
+
+/* Removes the request at the head of the copy queue and reports its completion */
+static void _cyhal_dma_copy_finish(cyhal_dma_t *obj, cyhal_dma_event_t event)
+{
+    uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+    cyhal_dma_copy_t *req = obj->copy_head;
+    obj->copy_head = req->next;
+    if (obj->copy_head == NULL)
+    {
+        obj->copy_tail = NULL;
+    }
+    req->next = NULL;
+    cyhal_system_critical_section_exit(saved_intr_status);
+
+    cyhal_dma_event_callback_t callback = (cyhal_dma_event_callback_t)req->callback_data.callback;
+    if (callback != NULL)
+    {
+        callback(req->callback_data.callback_arg, event);
+    }
+}
+
+/* Starts the queued requests until one of them is successfully handed to the DMA. A request that a
+ * completion callback submits to an empty queue is started by the submit itself, so stop once the
+ * requests that were already queued have been used up. */
+static void _cyhal_dma_copy_service(cyhal_dma_t *obj)
+{
+    while ((obj->copy_head != NULL) && (CY_RSLT_SUCCESS != _cyhal_dma_copy_start(obj)))
+    {
+        bool is_last = (obj->copy_head->next == NULL);
+        _cyhal_dma_copy_finish(obj, CYHAL_DMA_GENERIC_ERROR);
+        if (is_last)
+        {
+            break;
+        }
+    }
+}
+
+/* Callback argument is the DMA object running the copies */
+static void _cyhal_dma_copy_handler(void *callback_arg, cyhal_dma_event_t event)
+{
+    cyhal_dma_t *obj = (cyhal_dma_t *)callback_arg;
+    cyhal_dma_copy_t *req = obj->copy_head;
+    if (req != NULL)
+    {
+        if (event == CYHAL_DMA_TRANSFER_COMPLETE)
+        {
+            if (!req->is_fill)
+            {
+                req->src_addr += req->chunk;
+            }
+            req->dst_addr += req->chunk;
+            req->remaining -= req->chunk;
+        }
+
+        if ((event != CYHAL_DMA_TRANSFER_COMPLETE) || (req->remaining == 0u))
+        {
+            bool is_last = (req->next == NULL);
+            _cyhal_dma_copy_finish(obj, event);
+            if (is_last)
+            {
+                return;
+            }
+        }
+        _cyhal_dma_copy_service(obj);
+    }
+}
+
+static cy_rslt_t _cyhal_dma_copy_submit(cyhal_dma_t *obj, cyhal_dma_copy_t *req)
+{
+    if ((obj->transfer_type != BTSS_DMAC_CONFIG_REG_FLOWCNTRL_MEMORY_TO_MEMORY) || (req->remaining == 0u))
+    {
+        return CYHAL_DMA_RSLT_ERR_INVALID_PARAMETER;
+    }
+
+    // The object is dedicated to copies, so it is safe to take over its callback
+    if (obj->callback_data.callback != (cy_israddress)&_cyhal_dma_copy_handler)
+    {
+        cyhal_dma_register_callback(obj, &_cyhal_dma_copy_handler, obj);
+    }
+
+    req->next = NULL;
+    uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+    bool is_idle = (obj->copy_head == NULL);
+    if (is_idle)
+    {
+        obj->copy_head = req;
+    }
+    else
+    {
+        obj->copy_tail->next = req;
+    }
+    obj->copy_tail = req;
+    cyhal_system_critical_section_exit(saved_intr_status);
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    if (is_idle)
+    {
+        result = _cyhal_dma_copy_start(obj);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            // Drop the failed request without calling back, then move on to anything queued meanwhile
+            saved_intr_status = cyhal_system_critical_section_enter();
+            obj->copy_head = req->next;
+            if (obj->copy_head == NULL)
+            {
+                obj->copy_tail = NULL;
+            }
+            cyhal_system_critical_section_exit(saved_intr_status);
+            _cyhal_dma_copy_service(obj);
+        }
+    }
+    return result;
+}
+
+cy_rslt_t cyhal_dma_memcpy_async(cyhal_dma_t *obj, cyhal_dma_copy_t *req, void *dst, const void *src, size_t length,
+                                 cyhal_dma_event_callback_t callback, void *callback_arg)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != req);
+    CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
+
+    req->src_addr = (uint32_t)src;
+    req->dst_addr = (uint32_t)dst;
+    req->remaining = length;
+    req->chunk = 0u;
+    req->fill = 0u;
+    req->is_fill = false;
+    req->callback_data.callback = (cy_israddress)callback;
+    req->callback_data.callback_arg = callback_arg;
+
+    return _cyhal_dma_copy_submit(obj, req);
+}
+
+cy_rslt_t cyhal_dma_memset_async(cyhal_dma_t *obj, cyhal_dma_copy_t *req, void *dst, uint8_t value, size_t length,
+                                 cyhal_dma_event_callback_t callback, void *callback_arg)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != req);
+    CY_ASSERT(obj->resource.type == CYHAL_RSC_DMA);
+
+    req->src_addr = 0u;
+    req->dst_addr = (uint32_t)dst;
+    req->remaining = length;
+    req->chunk = 0u;
+    req->fill = (uint32_t)value * 0x01010101u;
+    req->is_fill = true;
+    req->callback_data.callback = (cy_israddress)callback;
+    req->callback_data.callback_arg = callback_arg;
+
+    return _cyhal_dma_copy_submit(obj, req);
+}
+
 cy_rslt_t cyhal_dma_connect_digital(cyhal_dma_t *obj, cyhal_source_t source, cyhal_dma_input_t input)
 {
     CY_UNUSED_PARAMETER(obj);
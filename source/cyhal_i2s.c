@@ -139,12 +139,15 @@ static const _cyhal_audioss_interface_t _cyhal_i2s_interface =
     .event_mask_full = CYHAL_I2S_RX_FULL,
     .event_mask_half_full = CYHAL_I2S_RX_HALF_FULL,
     .event_rx_complete = CYHAL_I2S_ASYNC_RX_COMPLETE,
+    .event_rx_overflow = CYHAL_I2S_RX_OVERFLOW,
 #endif
     .event_tx_complete = CYHAL_I2S_ASYNC_TX_COMPLETE,
+    .event_tx_underflow = CYHAL_I2S_TX_UNDERFLOW,
     .err_invalid_pin = CYHAL_I2S_RSLT_ERR_INVALID_PIN,
     .err_invalid_arg = CYHAL_I2S_RSLT_ERR_INVALID_ARG,
     .err_clock = CYHAL_I2S_RSLT_ERR_CLOCK,
     .err_not_supported = CYHAL_I2S_RSLT_NOT_SUPPORTED,
+    .err_busy = CYHAL_I2S_RSLT_ERR_BUSY,
 };
 
 cy_rslt_t cyhal_i2s_init(cyhal_i2s_t *obj, const cyhal_i2s_pins_t* tx_pins, const cyhal_i2s_pins_t* rx_pins,
@@ -25,6 +25,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string.h>
 #include "cyhal_adc.h"
 #include "cyhal_comp.h"
 #include "cyhal_hwmgr.h"
@@ -52,15 +53,22 @@
 * </li>
 * </ul>
 *
+* The hardware has no gain amplifier. The gain set with \ref cyhal_pdm_pcm_set_gain (or the
+* left_gain/right_gain configuration fields) is applied in software to the active channel, from
+* -120 (-60 dB) to 48 (+24 dB) in 0.5 dB steps, with saturation to 16 bits. The same software stage
+* also provides an optional DC blocker (\ref cyhal_pdm_pcm_set_dc_blocker) and 2x/3x FIR
+* decimation (\ref cyhal_pdm_pcm_set_decimation). Processed samples are returned as sign-extended
+* 16-bit values.
+*
 * The following features are not supported:<ul>
 * <li>Stereo</li>
 * <li>DMA Transfers</li>
-* <li>Left/Right Gain Amplifier Configuration. The gain is always unity</li>
 * <li>CYHAL_PDM_PCM_RX_NOT_EMPTY and CYHAL_PDM_PCM_RX_UNDERFLOW events</li>
 * </ul>
 *
 * Limitations:
 * The PDM-PCM read using cyhal_pdm_pcm_read() can only be performed with length of 128.
+* Use \ref cyhal_pdm_pcm_stream_start to receive continuously in frames of any other length.
 *
 * \} group_hal_impl_pdmpcm
 */
@@ -87,13 +95,197 @@ extern "C"
 #define _CYHAL_PDM_PCM_SAMPLE_RATE_UNDEFINED    ((cy_en_pdm_pcm_sample_rate_t)0xFF)
 #define _CYHAL_PDM_PCM_STABILIZE_TIME_MS        (25u)
 #define _CYHAL_PDM_PCM_MILLISECONDS             (1000u)
+#define _CYHAL_PDM_PCM_READ_TIMEOUT_US          (20000u) /* A block takes 16 ms at 8 kHz */
 
 #define _CYHAL_PDM_PCM_MAX_FIFO_LEVEL           (0xFFUL)
 #define _CYHAL_PDM_PCM_HALF_FIFO_LEVEL          ((uint32_t)((_CYHAL_PDM_PCM_MAX_FIFO_LEVEL) >> 1u))
 #define _CYHAL_PDM_PCM_NOT_EMPTY_FIFO_LEVEL     (0UL)
 
+#define _CYHAL_PDM_PCM_GAIN_UNITY               (32768L)
+#define _CYHAL_PDM_PCM_GAIN_MIN                 (-120)
+#define _CYHAL_PDM_PCM_GAIN_MAX                 (48)
+#define _CYHAL_PDM_PCM_GAIN_STEPS_PER_6DB       (12)
+#define _CYHAL_PDM_PCM_GAIN_6DB                 (65381L)    /* 10^(6/20) in Q15 */
+
 static cyhal_pdm_pcm_t *_cyhal_pdm_pcm_config_struct;
 static bool _cyhal_amic_ready = false;
+/* Scratch block for a stream block that cannot be read straight into the ring. Only the single
+ * PDM/PCM interrupt handler uses it. */
+static uint32_t _cyhal_pdm_pcm_stream_scratch[CYHAL_PDM_PCM_STREAM_BLOCK];
+
+/* 10^(n/40) in Q15 for n = 0..11, i.e. 0 dB to 5.5 dB in 0.5 dB steps */
+static const int32_t _cyhal_pdm_pcm_gain_table[_CYHAL_PDM_PCM_GAIN_STEPS_PER_6DB] =
+{
+    32768, 34710, 36766, 38945, 41252, 43697, 46286, 49029, 51934, 55011, 58271, 61723
+};
+
+/* Anti-alias filters for 2x and 3x decimation in Q15: Blackman-windowed sinc, cut off at the new
+ * Nyquist frequency, with unity DC gain. The 2x filter is half-band (every other tap is zero),
+ * the 3x filter a third-band (Nyquist) filter. */
+static const int16_t _cyhal_pdm_pcm_decim_taps[CYHAL_PDM_PCM_MAX_DECIMATION - 1u][_CYHAL_PDM_PCM_DECIM_TAPS] =
+{
+    { -22, 0, 359, 0, -1928, 0, 9783, 16384, 9783, 0, -1928, 0, 359, 0, -22 },
+    { 19, 0, -311, -768, 0, 3496, 8483, 10930, 8483, 3496, 0, -768, -311, 0, 19 },
+};
+
+/*******************************************************************************
+*       Software processing
+*******************************************************************************/
+
+/* Converts a gain in 0.5 dB units to a Q15 multiplier */
+static int32_t _cyhal_pdm_pcm_gain_to_q15(int16_t gain)
+{
+    int32_t steps = gain;
+    int32_t octaves = 0;
+    while (steps < 0)
+    {
+        steps += _CYHAL_PDM_PCM_GAIN_STEPS_PER_6DB;
+        octaves--;
+    }
+    while (steps >= _CYHAL_PDM_PCM_GAIN_STEPS_PER_6DB)
+    {
+        steps -= _CYHAL_PDM_PCM_GAIN_STEPS_PER_6DB;
+        octaves++;
+    }
+
+    int64_t q15 = _cyhal_pdm_pcm_gain_table[steps];
+    for (; octaves > 0; octaves--)
+    {
+        q15 = (q15 * _CYHAL_PDM_PCM_GAIN_6DB + (_CYHAL_PDM_PCM_GAIN_UNITY / 2)) >> 15;
+    }
+    for (; octaves < 0; octaves++)
+    {
+        q15 = ((q15 << 15) + (_CYHAL_PDM_PCM_GAIN_6DB / 2)) / _CYHAL_PDM_PCM_GAIN_6DB;
+    }
+    return (int32_t)q15;
+}
+
+static inline bool _cyhal_pdm_pcm_is_processing(const cyhal_pdm_pcm_t *obj)
+{
+    return (obj->gain != _CYHAL_PDM_PCM_GAIN_UNITY) || (obj->dc_pole != 0u) || (obj->decimation > 1u);
+}
+
+/* Runs the DC blocker, decimation and gain over one block in place. Returns the number of
+ * output words, which is less than length when decimating. */
+static size_t _cyhal_pdm_pcm_process(cyhal_pdm_pcm_t *obj, uint32_t *data, size_t length)
+{
+    const int32_t pole = (int32_t)obj->dc_pole;
+    const int32_t gain = obj->gain;
+    size_t out = 0u;
+
+    for (size_t i = 0u; i < length; i++)
+    {
+        int32_t sample = (int16_t)data[i];
+
+        if (pole != 0)
+        {
+            // One-pole high-pass: y[n] = x[n] - x[n-1] + a * y[n-1]. The truncation error is fed
+            // back into the next sample, otherwise a constant input leaves a residual offset of up
+            // to 1 / (2 * (1 - a)) LSBs.
+            int64_t acc = ((int64_t)(sample - obj->dc_prev_in) << 15) + ((int64_t)pole * obj->dc_prev_out) + obj->dc_error;
+            int32_t y = (int32_t)(acc >> 15);
+            obj->dc_error = (int32_t)(acc - ((int64_t)y << 15));
+            obj->dc_prev_in = sample;
+            sample = __SSAT(y, 16);
+            obj->dc_prev_out = sample;
+        }
+
+        if (obj->decimation > 1u)
+        {
+            // FIR decimation: every input enters the history, but the filter is only evaluated for
+            // the samples that are kept. The history and phase carry across blocks.
+            obj->decim_hist[obj->decim_pos] = (int16_t)sample;
+            obj->decim_pos = (uint8_t)((obj->decim_pos + 1u) % _CYHAL_PDM_PCM_DECIM_TAPS);
+            if (++obj->decim_phase < obj->decimation)
+            {
+                continue;
+            }
+            obj->decim_phase = 0u;
+
+            const int16_t *taps = _cyhal_pdm_pcm_decim_taps[obj->decimation - 2u];
+            uint8_t pos = obj->decim_pos;
+            int32_t acc = _CYHAL_PDM_PCM_GAIN_UNITY / 2;
+            for (uint32_t k = 0u; k < _CYHAL_PDM_PCM_DECIM_TAPS; k++)
+            {
+                acc += (int32_t)taps[k] * obj->decim_hist[pos];
+                pos = (uint8_t)((pos + 1u) % _CYHAL_PDM_PCM_DECIM_TAPS);
+            }
+            sample = __SSAT(acc >> 15, 16);
+        }
+
+        if (gain != _CYHAL_PDM_PCM_GAIN_UNITY)
+        {
+            sample = __SSAT((int32_t)(((int64_t)sample * gain) >> 15), 16);
+        }
+
+        data[out++] = (uint32_t)sample;
+    }
+
+    return out;
+}
+
+static void _cyhal_pdm_pcm_reset_processing(cyhal_pdm_pcm_t *obj)
+{
+    obj->dc_prev_in = 0;
+    obj->dc_prev_out = 0;
+    obj->dc_error = 0;
+    (void)memset(obj->decim_hist, 0, sizeof(obj->decim_hist));
+    obj->decim_pos = 0u;
+    obj->decim_phase = 0u;
+}
+
+/*******************************************************************************
+*       Streaming receive
+*******************************************************************************/
+
+/* Appends one half-FIFO to the stream ring. Returns false if the ring had no room for it. */
+static bool _cyhal_pdm_pcm_stream_push(cyhal_pdm_pcm_t *obj, uint8_t *fifo_context)
+{
+    uint8_t length = CYHAL_PDM_PCM_STREAM_BLOCK;
+    size_t space = obj->stream_size - obj->stream_count;
+    size_t contiguous = obj->stream_size - obj->stream_head;
+    size_t produced;
+    bool stored = true;
+
+    if ((space >= CYHAL_PDM_PCM_STREAM_BLOCK) && (contiguous >= CYHAL_PDM_PCM_STREAM_BLOCK))
+    {
+        // Zero copy: the block fits before the end of the ring and is processed in place
+        uint32_t *dst = &obj->stream_ring[obj->stream_head];
+        (void) Cy_PDM_PCM_ReadFifoAll(dst, &length, fifo_context);
+        produced = _cyhal_pdm_pcm_is_processing(obj)
+            ? _cyhal_pdm_pcm_process(obj, dst, CYHAL_PDM_PCM_STREAM_BLOCK)
+            : CYHAL_PDM_PCM_STREAM_BLOCK;
+    }
+    else
+    {
+        // The FIFO must always be read to free the ping-pong buffer for the next block
+        uint32_t *block = _cyhal_pdm_pcm_stream_scratch;
+        (void) Cy_PDM_PCM_ReadFifoAll(&block[0], &length, fifo_context);
+        produced = _cyhal_pdm_pcm_is_processing(obj)
+            ? _cyhal_pdm_pcm_process(obj, &block[0], CYHAL_PDM_PCM_STREAM_BLOCK)
+            : CYHAL_PDM_PCM_STREAM_BLOCK;
+
+        if (produced <= space)
+        {
+            size_t first = (produced < contiguous) ? produced : contiguous;
+            memcpy(&obj->stream_ring[obj->stream_head], &block[0], first * sizeof(uint32_t));
+            memcpy(&obj->stream_ring[0], &block[first], (produced - first) * sizeof(uint32_t));
+        }
+        else
+        {
+            stored = false;
+        }
+    }
+
+    if (stored)
+    {
+        obj->stream_head = (obj->stream_head + produced) % obj->stream_size;
+        obj->stream_count += produced;
+        obj->stream_unreported += produced;
+    }
+
+    return stored;
+}
 
 /*******************************************************************************
 *       Callback Interrupt Service Routine
@@ -141,13 +333,48 @@ void _cyhal_pdm_pcm_cb(uint8_t *pFifoCntx)
         (void) Cy_PDM_PCM_ReadFifoAll(&stabilization_data[0], &length, _cyhal_pdm_pcm_config_struct->fifo_context);
         _cyhal_pdm_pcm_config_struct->fifo_context = NULL;
     }
+    else if (_cyhal_pdm_pcm_config_struct->stream_ring != NULL)
+    {
+        // In streaming mode every block is consumed here, so the previous context is never left unread
+        bool stored = _cyhal_pdm_pcm_stream_push(_cyhal_pdm_pcm_config_struct, _cyhal_pdm_pcm_config_struct->fifo_context);
+        _cyhal_pdm_pcm_config_struct->fifo_context = NULL;
+
+        if (callback != NULL)
+        {
+            if (!stored && (_cyhal_pdm_pcm_config_struct->events & CYHAL_PDM_PCM_RX_OVERFLOW))
+            {
+                (callback)(_cyhal_pdm_pcm_config_struct->callback_data.callback_arg, CYHAL_PDM_PCM_RX_OVERFLOW);
+            }
+            if (!ov_status && (_cyhal_pdm_pcm_config_struct->events & CYHAL_PDM_PCM_RX_HALF_FULL))
+            {
+                (callback)(_cyhal_pdm_pcm_config_struct->callback_data.callback_arg, CYHAL_PDM_PCM_RX_HALF_FULL);
+            }
+        }
+
+        // Report once per block even if several thresholds were crossed, the application
+        // picks up everything that is available through cyhal_pdm_pcm_stream_peek().
+        if (_cyhal_pdm_pcm_config_struct->stream_unreported >= _cyhal_pdm_pcm_config_struct->stream_threshold)
+        {
+            _cyhal_pdm_pcm_config_struct->stream_unreported %= _cyhal_pdm_pcm_config_struct->stream_threshold;
+            if ((_cyhal_pdm_pcm_config_struct->events & CYHAL_PDM_PCM_ASYNC_COMPLETE) && (callback != NULL))
+            {
+                (callback)(_cyhal_pdm_pcm_config_struct->callback_data.callback_arg, CYHAL_PDM_PCM_ASYNC_COMPLETE);
+            }
+        }
+    }
     else
     {
         if (_cyhal_pdm_pcm_config_struct->async_data != NULL)
         {
             (void) Cy_PDM_PCM_ReadFifoAll((uint32_t *)_cyhal_pdm_pcm_config_struct->async_data, &length, _cyhal_pdm_pcm_config_struct->fifo_context);
+            if (_cyhal_pdm_pcm_is_processing(_cyhal_pdm_pcm_config_struct))
+            {
+                // Decimation is rejected in read_async, so the length is unchanged
+                (void) _cyhal_pdm_pcm_process(_cyhal_pdm_pcm_config_struct, (uint32_t *)_cyhal_pdm_pcm_config_struct->async_data, length);
+            }
             _cyhal_pdm_pcm_config_struct->fifo_context = NULL;
             _cyhal_pdm_pcm_config_struct->async_data = NULL;
+            _cyhal_utils_wait_signal(_cyhal_pdm_pcm_config_struct->waiter);
             if ((_cyhal_pdm_pcm_config_struct->events & CYHAL_PDM_PCM_ASYNC_COMPLETE) && (callback != NULL))
             {
                 (callback)(_cyhal_pdm_pcm_config_struct->callback_data.callback_arg, CYHAL_PDM_PCM_ASYNC_COMPLETE);
@@ -237,6 +464,9 @@ cy_rslt_t cyhal_pdm_pcm_init(cyhal_pdm_pcm_t *obj, cyhal_gpio_t pin_data, cyhal_
     obj->source = CY_PDM_PCM_DMIC;
     obj->is_mic_ready = true;
     obj->is_ntd_ready = true;
+    obj->is_right = (cfg->mode == CYHAL_PDM_PCM_MODE_RIGHT);
+    obj->gain = _CYHAL_PDM_PCM_GAIN_UNITY;
+    obj->decimation = 1u;
 
     if ((cfg->sample_rate == _CYHAL_PDM_PCM_SAMPLE_RATE_2MHZ) && (cfg->decimation_rate == _CYHAL_PDM_PCM_DECIMATION_RATE_256))
     {
@@ -268,7 +498,7 @@ cy_rslt_t cyhal_pdm_pcm_init(cyhal_pdm_pcm_t *obj, cyhal_gpio_t pin_data, cyhal_
     }
     
     if ((sample_rate == _CYHAL_PDM_PCM_SAMPLE_RATE_UNDEFINED) || (cfg->mode == CYHAL_PDM_PCM_MODE_STEREO) 
-        || (cfg->word_length != 16) || (cfg->left_gain != 0) || (cfg->right_gain != 0))
+        || (cfg->word_length != 16) || (cyhal_pdm_pcm_set_gain(obj, cfg->left_gain, cfg->right_gain) != CY_RSLT_SUCCESS))
     {
         result = CYHAL_PDM_PCM_RSLT_ERR_INVALID_CONFIG_PARAM;
     }
@@ -415,6 +645,7 @@ void cyhal_pdm_pcm_free(cyhal_pdm_pcm_t *obj)
 {
     CY_ASSERT(NULL != obj);
 
+    obj->stream_ring = NULL;
     Cy_PDM_PCM_Disable(obj->base);
     Cy_PDM_PCM_ClearFifo();
     Cy_PDM_PCM_DeInit(obj->base);
@@ -441,6 +672,7 @@ void cyhal_pdm_pcm_free(cyhal_pdm_pcm_t *obj)
     if (obj->pm_callback_data.callback != NULL)
         _cyhal_syspm_unregister_peripheral_callback(&(obj->pm_callback_data));
 
+    _cyhal_utils_wait_free(&obj->wait);
     _cyhal_utils_release_if_used(&(obj->pin_clk));
     _cyhal_utils_release_if_used(&(obj->pin_data));
 }
@@ -499,8 +731,58 @@ bool cyhal_pdm_pcm_is_enabled(cyhal_pdm_pcm_t *obj)
 
 cy_rslt_t cyhal_pdm_pcm_set_gain(cyhal_pdm_pcm_t *obj, int16_t gain_left, int16_t gain_right)
 {
-    CY_UNUSED_PARAMETER(obj);
-    return ((gain_left == 0) && (gain_right == 0)) ? CY_RSLT_SUCCESS : CYHAL_PDM_PCM_RSLT_ERR_UNSUPPORTED;
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CYHAL_PDM_PCM_RSLT_ERR_BAD_PARAM;
+
+    if ((gain_left >= _CYHAL_PDM_PCM_GAIN_MIN) && (gain_left <= _CYHAL_PDM_PCM_GAIN_MAX)
+        && (gain_right >= _CYHAL_PDM_PCM_GAIN_MIN) && (gain_right <= _CYHAL_PDM_PCM_GAIN_MAX))
+    {
+        // Only one channel is converted, so only its gain is used
+        obj->gain = _cyhal_pdm_pcm_gain_to_q15(obj->is_right ? gain_right : gain_left);
+        result = CY_RSLT_SUCCESS;
+    }
+
+    return result;
+}
+
+cy_rslt_t cyhal_pdm_pcm_set_dc_blocker(cyhal_pdm_pcm_t *obj, uint16_t pole)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CYHAL_PDM_PCM_RSLT_ERR_BAD_PARAM;
+
+    if (pole < (uint16_t)_CYHAL_PDM_PCM_GAIN_UNITY)
+    {
+        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->dc_pole = pole;
+        obj->dc_prev_in = 0;
+        obj->dc_prev_out = 0;
+        obj->dc_error = 0;
+        cyhal_system_critical_section_exit(savedIntrStatus);
+        result = CY_RSLT_SUCCESS;
+    }
+
+    return result;
+}
+
+cy_rslt_t cyhal_pdm_pcm_set_decimation(cyhal_pdm_pcm_t *obj, uint8_t factor)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CYHAL_PDM_PCM_RSLT_ERR_BAD_PARAM;
+
+    if (cyhal_pdm_pcm_is_pending(obj))
+    {
+        result = CYHAL_PDM_PCM_RSLT_ERR_ASYNC_IN_PROGRESS;
+    }
+    else if ((factor >= 1u) && (factor <= CYHAL_PDM_PCM_MAX_DECIMATION))
+    {
+        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->decimation = factor;
+        _cyhal_pdm_pcm_reset_processing(obj);
+        cyhal_system_critical_section_exit(savedIntrStatus);
+        result = CY_RSLT_SUCCESS;
+    }
+
+    return result;
 }
 
 cy_rslt_t cyhal_pdm_pcm_clear(cyhal_pdm_pcm_t *obj)
@@ -513,18 +795,14 @@ cy_rslt_t cyhal_pdm_pcm_clear(cyhal_pdm_pcm_t *obj)
 cy_rslt_t cyhal_pdm_pcm_read(cyhal_pdm_pcm_t *obj, void *data, size_t *length)
 {
     CY_ASSERT(NULL != obj);
+    _cyhal_utils_wait_arm(&obj->wait);
+    obj->waiter = &obj->wait;
+
     cy_rslt_t result = cyhal_pdm_pcm_read_async(obj, data, *length);
     
     if (result == CY_RSLT_SUCCESS)
     {
-        int retry = 20; /* Conversion should take less than 20ms */
-        while (cyhal_pdm_pcm_is_pending(obj) && retry > 0)
-        {
-            cyhal_system_delay_ms(1u);
-            --retry;
-        }
-
-        if (retry == 0)
+        if (!_cyhal_utils_wait_for(&obj->wait, _CYHAL_PDM_PCM_READ_TIMEOUT_US))
         {
             cyhal_pdm_pcm_abort_async(obj);
             *length = 0;
@@ -535,6 +813,10 @@ cy_rslt_t cyhal_pdm_pcm_read(cyhal_pdm_pcm_t *obj, void *data, size_t *length)
         *length = 0;
     }
 
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->waiter = NULL;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
     return result;
 }
 
@@ -549,9 +831,14 @@ cy_rslt_t cyhal_pdm_pcm_read_async(cyhal_pdm_pcm_t *obj, void *data, size_t leng
     }
     else
     {
-        if ((length == _CYHAL_PDM_PCM_HALF_FIFO_LEVEL + 1) && (data != NULL))
+        if (obj->decimation > 1u)
         {
-            if ((obj->async_data != NULL) || !(obj->is_enabled))
+            // A decimated block is shorter than the fixed read length
+            result = CYHAL_PDM_PCM_RSLT_ERR_UNSUPPORTED;
+        }
+        else if ((length == _CYHAL_PDM_PCM_HALF_FIFO_LEVEL + 1) && (data != NULL))
+        {
+            if ((obj->async_data != NULL) || (obj->stream_ring != NULL) || !(obj->is_enabled))
             {
                 result = CYHAL_PDM_PCM_RSLT_ERR_ASYNC_IN_PROGRESS;
             }
@@ -568,13 +855,16 @@ cy_rslt_t cyhal_pdm_pcm_read_async(cyhal_pdm_pcm_t *obj, void *data, size_t leng
 
 bool cyhal_pdm_pcm_is_pending(cyhal_pdm_pcm_t *obj)
 {
-    return (obj->async_data != NULL);
+    return (obj->async_data != NULL) || (obj->stream_ring != NULL);
 }
 
 cy_rslt_t cyhal_pdm_pcm_abort_async(cyhal_pdm_pcm_t *obj)
 {
     obj->async_data = NULL;
-    return CY_RSLT_SUCCESS;
+    // A stream counts as pending, so aborting also ends it
+    return (obj->stream_ring != NULL)
+        ? cyhal_pdm_pcm_stream_stop(obj)
+        : CY_RSLT_SUCCESS;
 }
 
 void cyhal_pdm_pcm_register_callback(cyhal_pdm_pcm_t *obj, cyhal_pdm_pcm_event_callback_t callback, void *callback_arg)
@@ -591,6 +881,89 @@ void cyhal_pdm_pcm_enable_event(cyhal_pdm_pcm_t *obj, cyhal_pdm_pcm_event_t even
     obj->events = (enable) ? (obj->events | event) : (obj->events & ~event);
 }
 
+cy_rslt_t cyhal_pdm_pcm_stream_start(cyhal_pdm_pcm_t *obj, uint32_t *ring, size_t size, size_t threshold)
+{
+    CY_ASSERT(NULL != obj);
+    cy_rslt_t result = CYHAL_PDM_PCM_RSLT_ERR_BAD_PARAM;
+
+    if (obj->pm_transition_pending)
+    {
+        result = CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    else if ((ring != NULL) && (size >= CYHAL_PDM_PCM_STREAM_BLOCK) && (threshold > 0u) && (threshold <= size))
+    {
+        if ((obj->async_data != NULL) || (obj->stream_ring != NULL) || !(obj->is_enabled))
+        {
+            result = CYHAL_PDM_PCM_RSLT_ERR_ASYNC_IN_PROGRESS;
+        }
+        else
+        {
+            uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+            obj->stream_size = size;
+            obj->stream_threshold = threshold;
+            obj->stream_head = 0u;
+            obj->stream_tail = 0u;
+            obj->stream_count = 0u;
+            obj->stream_unreported = 0u;
+            _cyhal_pdm_pcm_reset_processing(obj);
+            obj->stream_ring = ring;
+            cyhal_system_critical_section_exit(savedIntrStatus);
+            result = CY_RSLT_SUCCESS;
+        }
+    }
+
+    return result;
+}
+
+cy_rslt_t cyhal_pdm_pcm_stream_stop(cyhal_pdm_pcm_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->stream_ring = NULL;
+    obj->stream_count = 0u;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return CY_RSLT_SUCCESS;
+}
+
+size_t cyhal_pdm_pcm_stream_peek(cyhal_pdm_pcm_t *obj, const uint32_t **data)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != data);
+    size_t available = 0u;
+
+    if (obj->stream_ring != NULL)
+    {
+        // stream_count only grows behind our back, so a stale value is safe
+        size_t count = obj->stream_count;
+        size_t contiguous = obj->stream_size - obj->stream_tail;
+        available = (count < contiguous) ? count : contiguous;
+        *data = &obj->stream_ring[obj->stream_tail];
+    }
+    else
+    {
+        *data = NULL;
+    }
+
+    return available;
+}
+
+void cyhal_pdm_pcm_stream_consume(cyhal_pdm_pcm_t *obj, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (obj->stream_ring != NULL)
+    {
+        CY_ASSERT(length <= obj->stream_count);
+        if (length > obj->stream_count)
+        {
+            length = obj->stream_count;
+        }
+        obj->stream_tail = (obj->stream_tail + length) % obj->stream_size;
+        obj->stream_count -= length;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+
 cy_rslt_t cyhal_pdm_pcm_set_async_mode(cyhal_pdm_pcm_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority)
 {
     CY_UNUSED_PARAMETER(obj);
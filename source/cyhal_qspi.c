@@ -464,6 +464,12 @@ static cy_rslt_t _cyhal_qspi_command_transfer(cyhal_qspi_t *obj, const cyhal_qsp
 
     cy_rslt_t result = _cyhal_qspi_check_command_struct(command);
 
+    if ((CY_RSLT_SUCCESS == result) && obj->xip_enabled)
+    {
+        /* The SMIF only issues commands through the memory-mapped window while XIP is enabled */
+        result = CYHAL_QSPI_RSLT_ERR_UNSUPPORTED;
+    }
+
     if (CY_RSLT_SUCCESS == result)
     {
         /* Does not support different bus_width for address and mode bits.
@@ -1100,6 +1106,7 @@ static cy_rslt_t _cyhal_qspi_init_common(cyhal_qspi_t *obj, const cyhal_qspi_con
 
         /* Configure first SSEL, that was found in cfg->gpios and make it active */
         obj->slave_select = _cyhal_qspi_slave_idx_to_smif_ss(found_ssel_idx);
+        obj->data_select[found_ssel_idx] = data_select;
         Cy_SMIF_SetDataSelect(obj->base, obj->slave_select, data_select);
 
         /* found_ssel_idx_cfg and below are already processed, no reason to start from index #0 */
@@ -1114,6 +1121,7 @@ static cy_rslt_t _cyhal_qspi_init_common(cyhal_qspi_t *obj, const cyhal_qspi_con
                 result = _cyhal_qspi_process_pin_set(obj, &pin_set, &data_select, &found_ssel_idx, !obj->dc_configured);
                 if (result == CY_RSLT_SUCCESS)
                 {
+                    obj->data_select[found_ssel_idx] = data_select;
                     Cy_SMIF_SetDataSelect(obj->base, _cyhal_qspi_slave_idx_to_smif_ss(found_ssel_idx), data_select);
                 }
             }
@@ -1221,6 +1229,7 @@ void cyhal_qspi_free(cyhal_qspi_t *obj)
         #endif // CYHAL_DRIVER_AVAILABLE_SYSPM
         if (obj->base != NULL)
         {
+            (void)cyhal_qspi_disable_xip(obj);
             Cy_SMIF_Disable(obj->base);
             Cy_SMIF_DeInit(obj->base);
             obj->base = NULL;
@@ -1297,6 +1306,7 @@ cy_rslt_t cyhal_qspi_slave_configure(cyhal_qspi_t *obj, const cyhal_qspi_slave_p
     cy_rslt_t result = _cyhal_qspi_process_pin_set(obj, pin_set, &data_select, &ssel_idx, true);
     if (CY_RSLT_SUCCESS == result)
     {
+        obj->data_select[ssel_idx] = data_select;
         Cy_SMIF_SetDataSelect(obj->base, _cyhal_qspi_slave_idx_to_smif_ss(ssel_idx), data_select);
     }
     return result;
@@ -1602,6 +1612,155 @@ void cyhal_qspi_enable_event(cyhal_qspi_t *obj, cyhal_qspi_event_t event, uint8_
     _cyhal_irq_set_priority(irqn, intr_priority);
 }
 
+/* Translates a HAL read command to the PDL command used by the memory-mapped window */
+static cy_rslt_t _cyhal_qspi_convert_xip_command(const cyhal_qspi_command_t *command, cy_stc_smif_mem_cmd_t *mem_cmd)
+{
+    cy_rslt_t result = _cyhal_qspi_check_command_struct(command);
+
+    if ((CY_RSLT_SUCCESS == result) && command->address.disabled)
+    {
+        /* Every access of the window sends its address */
+        result = CYHAL_QSPI_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if ((CY_RSLT_SUCCESS == result) && !command->mode_bits.disabled && (CYHAL_QSPI_CFG_SIZE_8 != command->mode_bits.size))
+    {
+        /* The window can only send a single mode byte */
+        result = CYHAL_QSPI_RSLT_ERR_UNSUPPORTED;
+    }
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        memset(mem_cmd, 0, sizeof(cy_stc_smif_mem_cmd_t));
+        mem_cmd->command = command->instruction.disabled
+            ? CY_SMIF_NO_COMMAND_OR_MODE : (uint32_t)(command->instruction.value & 0xFFu);
+        mem_cmd->cmdWidth = _cyhal_qspi_convert_bus_width(command->instruction.bus_width);
+        mem_cmd->addrWidth = _cyhal_qspi_convert_bus_width(command->address.bus_width);
+        mem_cmd->mode = command->mode_bits.disabled
+            ? CY_SMIF_NO_COMMAND_OR_MODE : (command->mode_bits.value & 0xFFu);
+        mem_cmd->modeWidth = _cyhal_qspi_convert_bus_width(command->mode_bits.bus_width);
+        mem_cmd->dummyCycles = command->dummy_cycles.dummy_count;
+        mem_cmd->dataWidth = _cyhal_qspi_convert_bus_width(command->data.bus_width);
+        #if (CY_IP_MXSMIF_VERSION >= 3)
+        if (command->instruction.disabled)
+        {
+            mem_cmd->cmdPresence = CY_SMIF_NOT_PRESENT;
+        }
+        else if (command->instruction.two_byte_cmd)
+        {
+            mem_cmd->cmdPresence = CY_SMIF_PRESENT_2BYTE;
+            mem_cmd->command = (uint32_t)(command->instruction.value & 0xFFu);
+            mem_cmd->commandH = (uint32_t)(command->instruction.value >> 8u);
+        }
+        else
+        {
+            mem_cmd->cmdPresence = CY_SMIF_PRESENT_1BYTE;
+        }
+        mem_cmd->cmdRate = (cy_en_smif_data_rate_t)command->instruction.data_rate;
+        mem_cmd->addrRate = (cy_en_smif_data_rate_t)command->address.data_rate;
+        mem_cmd->modePresence = command->mode_bits.disabled ? CY_SMIF_NOT_PRESENT : CY_SMIF_PRESENT_1BYTE;
+        mem_cmd->modeRate = (cy_en_smif_data_rate_t)command->mode_bits.data_rate;
+        mem_cmd->dummyCyclesPresence = (command->dummy_cycles.dummy_count != 0u) ? CY_SMIF_PRESENT_1BYTE : CY_SMIF_NOT_PRESENT;
+        mem_cmd->dummyCyclesRate = (cy_en_smif_data_rate_t)command->dummy_cycles.data_rate;
+        mem_cmd->dataRate = (cy_en_smif_data_rate_t)command->data.data_rate;
+        #endif /* CY_IP_MXSMIF_VERSION >= 3 */
+    }
+    return result;
+}
+
+cy_rslt_t cyhal_qspi_enable_xip(cyhal_qspi_t *obj, const cyhal_qspi_command_t *command, uint32_t base_address, uint32_t size)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != command);
+
+    #if CYHAL_DRIVER_AVAILABLE_SYSPM
+    if (obj->pm_transition_pending)
+    {
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+    }
+    #endif // CYHAL_DRIVER_AVAILABLE_SYSPM
+
+    /* The window is selected by masking the address, so it must be a naturally aligned power of two */
+    if ((size == 0u) || ((size & (size - 1u)) != 0u) || ((base_address & (size - 1u)) != 0u))
+    {
+        return CYHAL_QSPI_RSLT_ERR_BAD_ARGUMENT;
+    }
+    if (obj->xip_enabled || cyhal_qspi_is_busy(obj))
+    {
+        return CYHAL_QSPI_RSLT_ERR_UNSUPPORTED;
+    }
+
+    cy_stc_smif_mem_cmd_t read_cmd;
+    cy_rslt_t result = _cyhal_qspi_convert_xip_command(command, &read_cmd);
+
+    if (CY_RSLT_SUCCESS == result)
+    {
+        uint8_t ssel_idx = 0u;
+        while ((ssel_idx < SMIF_CHIP_TOP_SPI_SEL_NR) && (obj->slave_select != _cyhal_qspi_slave_idx_to_smif_ss(ssel_idx)))
+        {
+            ++ssel_idx;
+        }
+        CY_ASSERT(ssel_idx < SMIF_CHIP_TOP_SPI_SEL_NR);
+
+        /* Only the read path is set up, so the window is read-only */
+        cy_stc_smif_mem_device_cfg_t device_cfg;
+        memset(&device_cfg, 0, sizeof(device_cfg));
+        device_cfg.numOfAddrBytes = _cyhal_qspi_get_size(command->address.size);
+        device_cfg.readCmd = &read_cmd;
+        device_cfg.memSize = size;
+
+        cy_stc_smif_mem_config_t mem_cfg;
+        memset(&mem_cfg, 0, sizeof(mem_cfg));
+        mem_cfg.slaveSelect = obj->slave_select;
+        mem_cfg.flags = CY_SMIF_FLAG_MEMORY_MAPPED;
+        mem_cfg.dataSelect = obj->data_select[ssel_idx];
+        mem_cfg.baseAddress = base_address;
+        mem_cfg.memMappedSize = size;
+        mem_cfg.deviceCfg = &device_cfg;
+
+        cy_stc_smif_mem_config_t *mem_configs[] = { &mem_cfg };
+        cy_stc_smif_block_config_t block_cfg;
+        memset(&block_cfg, 0, sizeof(block_cfg));
+        block_cfg.memCount = 1u;
+        block_cfg.memConfig = mem_configs;
+
+        /* The PDL copies the configuration into the device registers, so it can live on the stack */
+        result = (cy_rslt_t)Cy_SMIF_MemInit(obj->base, &block_cfg, &obj->context);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            Cy_SMIF_SetMode(obj->base, CY_SMIF_MEMORY);
+            obj->xip_enabled = true;
+        }
+    }
+    return result;
+}
+
+cy_rslt_t cyhal_qspi_disable_xip(cyhal_qspi_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (obj->xip_enabled)
+    {
+        Cy_SMIF_SetMode(obj->base, CY_SMIF_NORMAL);
+        Cy_SMIF_MemDeInit(obj->base);
+        /* Cy_SMIF_MemDeInit clears the data select of every slave, restore them for command mode */
+        for (size_t i = 0; i < SMIF_CHIP_TOP_SPI_SEL_NR; ++i)
+        {
+            if (NC != obj->pin_ssel[i])
+            {
+                Cy_SMIF_SetDataSelect(obj->base, _cyhal_qspi_slave_idx_to_smif_ss((uint8_t)i), obj->data_select[i]);
+            }
+        }
+        obj->xip_enabled = false;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+bool cyhal_qspi_is_xip_enabled(const cyhal_qspi_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+    return obj->xip_enabled;
+}
+
 static bool _cyhal_qspi_is_async_in_progress(cyhal_qspi_t *obj)
 {
     CY_ASSERT(obj->base != NULL);
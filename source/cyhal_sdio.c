@@ -25,6 +25,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <string.h>
 #include "cyhal_hwmgr.h"
 #include "cyhal_sdio.h"
 #include "cyhal_system.h"
@@ -75,15 +76,19 @@ void _cyhal_sdio_cb(sdiod_event_code_t event_code, void *event_data)
             break;
         case SDIOD_EVENT_CODE_RX_DONE:
             event = _cyhal_sdio_config_struct[0]->events & CYHAL_SDIO_DEV_READ_COMPLETE;
+            _cyhal_utils_wait_signal(_cyhal_sdio_config_struct[0]->rx_waiter);
             break;
         case SDIOD_EVENT_CODE_TX_DONE:
             event = _cyhal_sdio_config_struct[0]->events & CYHAL_SDIO_DEV_WRITE_COMPLETE;
+            _cyhal_utils_wait_signal(_cyhal_sdio_config_struct[0]->tx_waiter);
             break;
         case SDIOD_EVENT_CODE_RX_ERROR:
             event = _cyhal_sdio_config_struct[0]->events & CYHAL_SDIO_DEV_READ_ERROR;
+            _cyhal_utils_wait_signal(_cyhal_sdio_config_struct[0]->rx_waiter);
             break;
         case SDIOD_EVENT_CODE_TX_ERROR:
             event = _cyhal_sdio_config_struct[0]->events & CYHAL_SDIO_DEV_WRITE_ERROR;
+            _cyhal_utils_wait_signal(_cyhal_sdio_config_struct[0]->tx_waiter);
             break;
         default:
             event = 0;
@@ -92,7 +97,8 @@ void _cyhal_sdio_cb(sdiod_event_code_t event_code, void *event_data)
 
     cyhal_sdio_event_callback_t callback = (cyhal_sdio_event_callback_t) _cyhal_sdio_config_struct[0]->callback_data.callback;
 
-    if (callback != NULL)
+    // The interrupt may only be enabled for a blocking transfer, in which case the application did not ask for callbacks
+    if ((callback != NULL) && (_cyhal_sdio_config_struct[0]->events != 0))
     {
         if (_cyhal_sdio_config_struct[0]->callback_data.callback_arg == NULL)
         {
@@ -105,6 +111,42 @@ void _cyhal_sdio_cb(sdiod_event_code_t event_code, void *event_data)
     }
 }
 
+/*******************************************************************************
+*       Blocking transfer completion
+*******************************************************************************/
+
+static inline void _cyhal_sdio_update_interrupt(const cyhal_sdio_t *obj)
+{
+    bool enable = (obj->events != 0) || (obj->rx_waiter != NULL) || (obj->tx_waiter != NULL);
+    enable ? sdiod_EnableInterrupt() : sdiod_DisableInterrupt();
+}
+
+/* Publishes a completion object for a blocking transfer and enables the interrupt that signals it */
+static void _cyhal_sdio_wait_attach(cyhal_sdio_t *obj, struct _cyhal_utils_wait **slot, _cyhal_utils_wait_t *wait)
+{
+    _cyhal_utils_wait_arm(wait);
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    *slot = wait;
+    _cyhal_sdio_update_interrupt(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+
+static void _cyhal_sdio_wait_detach(cyhal_sdio_t *obj, struct _cyhal_utils_wait **slot)
+{
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    *slot = NULL;
+    _cyhal_sdio_update_interrupt(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
+}
+
+/* Sleeps for up to 1 ms or until the transfer interrupt, and re-arms the completion object.
+ * The caller re-reads the status afterwards, so a completion after re-arming is not lost. */
+static inline void _cyhal_sdio_wait_slice(_cyhal_utils_wait_t *wait)
+{
+    (void) _cyhal_utils_wait_for(wait, 1000u);
+    wait->done = false;
+}
+
 /*******************************************************************************
 *       Deep Sleep Callback Service Routine
 *******************************************************************************/
@@ -182,6 +224,10 @@ cy_rslt_t cyhal_sdio_init(cyhal_sdio_t *obj, cyhal_gpio_t cmd, cyhal_gpio_t clk,
     obj->pin_data_3 = NC;
     obj->hw_inited = false;
     obj->is_ready = false;
+    obj->rx_waiter = NULL;
+    obj->tx_waiter = NULL;
+    memset(&obj->rx_wait, 0, sizeof(obj->rx_wait));
+    memset(&obj->tx_wait, 0, sizeof(obj->tx_wait));
     obj->callback_data.callback = NULL;
     obj->callback_data.callback_arg = NULL;
 
@@ -308,6 +354,9 @@ void cyhal_sdio_free(cyhal_sdio_t *obj)
 
     _cyhal_syspm_unregister_peripheral_callback(&(obj->pm_callback_data));
 
+    _cyhal_utils_wait_free(&obj->rx_wait);
+    _cyhal_utils_wait_free(&obj->tx_wait);
+
     _cyhal_utils_release_if_used(&(obj->pin_clk));
     _cyhal_utils_release_if_used(&(obj->pin_cmd));
     _cyhal_utils_release_if_used(&(obj->pin_data_0));
@@ -435,8 +484,10 @@ void cyhal_sdio_enable_event(cyhal_sdio_t *obj, cyhal_sdio_event_t event, uint8_
 {
     CY_UNUSED_PARAMETER(intr_priority);
 
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
     obj->events = (enable) ? (obj->events | event) : (obj->events & ~event);
-    (obj->events != 0) ? sdiod_EnableInterrupt() : sdiod_DisableInterrupt();
+    _cyhal_sdio_update_interrupt(obj);
+    cyhal_system_critical_section_exit(savedIntrStatus);
 }
 
 cy_rslt_t cyhal_sdio_init_cfg(cyhal_sdio_t *obj, const cyhal_sdio_configurator_t *cfg)
@@ -526,6 +577,8 @@ cy_rslt_t cyhal_sdio_dev_read(cyhal_sdio_t *obj, uint8_t *data, size_t length, u
 
     if (obj->is_ready)
     {
+        _cyhal_sdio_wait_attach(obj, &obj->rx_waiter, &obj->rx_wait);
+
         sdiod_status_t dev_status = sdiod_get_RxStatus();
         // Initiate async read if it was not initiated before
         if ((dev_status != SDIOD_STATUS_ASYNC_IN_PROGRESS)
@@ -539,12 +592,14 @@ cy_rslt_t cyhal_sdio_dev_read(cyhal_sdio_t *obj, uint8_t *data, size_t length, u
             dev_status = sdiod_get_RxStatus();
             while ((SDIOD_STATUS_SUCCESS != dev_status) && (timeout_ms > 0))
             {
-                cyhal_system_delay_ms(1);
+                _cyhal_sdio_wait_slice(&obj->rx_wait);
                 dev_status = sdiod_get_RxStatus();
                 timeout_ms--;
             }
         }
 
+        _cyhal_sdio_wait_detach(obj, &obj->rx_waiter);
+
         if ((dev_status == SDIOD_STATUS_SUCCESS) && (timeout_ms != 0))
         {
             result = CY_RSLT_SUCCESS;
@@ -566,6 +621,8 @@ cy_rslt_t cyhal_sdio_dev_write(cyhal_sdio_t *obj, const uint8_t *data, size_t le
 
     if (obj->is_ready)
     {
+        _cyhal_sdio_wait_attach(obj, &obj->tx_waiter, &obj->tx_wait);
+
         sdiod_status_t dev_status = sdiod_get_TxStatus();
 
         // Initiate async write if it was not initiated before
@@ -580,12 +637,14 @@ cy_rslt_t cyhal_sdio_dev_write(cyhal_sdio_t *obj, const uint8_t *data, size_t le
             dev_status = sdiod_get_TxStatus();
             while ((SDIOD_STATUS_SUCCESS != dev_status) && (timeout_ms > 0))
             {
-                cyhal_system_delay_ms(1);
+                _cyhal_sdio_wait_slice(&obj->tx_wait);
                 dev_status = sdiod_get_TxStatus();
                 timeout_ms--;
             }
         }
 
+        _cyhal_sdio_wait_detach(obj, &obj->tx_waiter);
+
         if ((dev_status == SDIOD_STATUS_SUCCESS) && (timeout_ms != 0))
         {
             result = CY_RSLT_SUCCESS;
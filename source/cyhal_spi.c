@@ -48,6 +48,18 @@
  * SPI master Slave Select pins are configured in GPIO mode to support asymmetric data transfers.
  * Therefore these pins are not restricted to direct connections to the SPI hardware
  *
+ * \section section_hal_impl_spi_dma DMA transfers
+ * By default, \ref cyhal_spi_transfer_async refills the FIFO from the SCB interrupt.
+ * In master mode the transfers can instead be moved to DMA by calling \ref cyhal_spi_set_async_mode
+ * with \ref CYHAL_ASYNC_DMA. One DMA channel feeds the TX FIFO and another drains the RX FIFO, so
+ * the CPU is only interrupted once every 4095 words. If tx_length is shorter than rx_length the
+ * remaining words are clocked out using the write_fill value, and received words beyond rx_length
+ * are discarded. \ref cyhal_spi_transfer uses the same path when DMA mode is selected.
+ * The DMA channels are shared with the other SCB blocks. If another block is using the receive
+ * channel, each block of the transfer waits in the DMA channel queue, and its transmit side is only
+ * started once the receive side has been granted the channel, so that no words are clocked in while
+ * nothing drains the RX FIFO.
+ *
  * \} group_hal_impl_spi
  */
 
@@ -61,6 +73,9 @@
 #include "cyhal_system.h"
 #include "cyhal_syspm.h"
 #include "cyhal_clock.h"
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+#include "cyhal_dma.h"
+#endif
 #include "cyhal_irq_impl.h"
 
 #if (CYHAL_DRIVER_AVAILABLE_SPI)
@@ -89,6 +104,11 @@ extern "C"
 #define _CYHAL_SPI_SSEL_ACTIVATE            true
 #define _CYHAL_SPI_SSEL_DEACTIVATE          false
 
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+/* Maximum number of elements moved by one pair of TX/RX DMA requests */
+#define _CYHAL_SPI_DMA_MAX_LENGTH           (4095u)
+#endif
+
 // BWC: PDL introduced new asymmetric transfer function finalized by version 3.20
 #if CY_SCB_DRV_VERSION_MINOR >= 20 && defined(COMPONENT_CAT1) && CY_SCB_DRV_VERSION_MAJOR == 3
 #define _CYHAL_SPI_ASYMM_PDL_FUNC_AVAIL
@@ -402,6 +422,217 @@ static void _cyhal_spi_cb_wrapper(uint32_t event)
     }
 }
 
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+static const cyhal_dest_t _cyhal_spi_dma_tx_trigger[] =
+{
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB0_TX,
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB1_TX,
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB2_TX,
+};
+
+static const cyhal_source_t _cyhal_spi_dma_rx_trigger[] =
+{
+    CYHAL_TRIGGER_DMAC_SCB0_RX_TO_MEM,
+    CYHAL_TRIGGER_DMAC_SCB1_RX_TO_MEM,
+    CYHAL_TRIGGER_DMAC_SCB2_RX_TO_MEM,
+};
+
+static uint32_t _cyhal_spi_dma_width(const cyhal_spi_t *obj)
+{
+    return (obj->data_bits <= 8u) ? 8u : ((obj->data_bits <= 16u) ? 16u : 32u);
+}
+
+static void _cyhal_spi_dma_finish(cyhal_spi_t *obj, cyhal_spi_event_t event)
+{
+    obj->dma_tx_buff = NULL;
+    obj->dma_rx_buff = NULL;
+    obj->dma_length = 0u;
+    obj->pending = _CYHAL_SPI_PENDING_NONE;
+    _cyhal_ssel_switch_state(obj, obj->active_ssel, _CYHAL_SPI_SSEL_DEACTIVATE);
+
+    cyhal_spi_event_callback_t callback = (cyhal_spi_event_callback_t) obj->callback_data.callback;
+    if ((0u != (obj->irq_cause & (uint32_t)event)) && (NULL != callback))
+    {
+        /* Indicates read/write operations will be in a callback */
+        obj->op_in_callback = true;
+        callback(obj->callback_data.callback_arg, event);
+        obj->op_in_callback = false;
+    }
+}
+
+/* Programs and starts the next block of up to _CYHAL_SPI_DMA_MAX_LENGTH elements. Each direction uses
+ * at most two segments: the user data, followed by write_fill words (TX) or discarded words (RX). */
+static cy_rslt_t _cyhal_spi_dma_start_block(cyhal_spi_t *obj)
+{
+    uint32_t width = _cyhal_spi_dma_width(obj);
+    uint32_t block = (obj->dma_length > _CYHAL_SPI_DMA_MAX_LENGTH) ? _CYHAL_SPI_DMA_MAX_LENGTH : obj->dma_length;
+    uint32_t tx_data = (obj->dma_tx_length > block) ? block : obj->dma_tx_length;
+    uint32_t rx_data = (obj->dma_rx_length > block) ? block : obj->dma_rx_length;
+
+    cyhal_dma_cfg_t tx_cfg[2];
+    cyhal_dma_cfg_t rx_cfg[2];
+    size_t tx_segments = 0u;
+    size_t rx_segments = 0u;
+
+    if (tx_data > 0u)
+    {
+        tx_cfg[tx_segments].src_addr = (uint32_t)obj->dma_tx_buff;
+        tx_cfg[tx_segments].src_increment = 1;
+        tx_cfg[tx_segments].length = tx_data;
+        tx_segments++;
+    }
+    if (block > tx_data)
+    {
+        tx_cfg[tx_segments].src_addr = (uint32_t)&obj->dma_fill;
+        tx_cfg[tx_segments].src_increment = 0;
+        tx_cfg[tx_segments].length = block - tx_data;
+        tx_segments++;
+    }
+    for (size_t i = 0u; i < tx_segments; i++)
+    {
+        tx_cfg[i].dst_addr = (uint32_t)&obj->base->TX_FIFO_WR;
+        tx_cfg[i].dst_increment = 0;
+        tx_cfg[i].transfer_width = width;
+        tx_cfg[i].burst_size = CYHAL_DMA_BURST_SIZE_AUTO;
+        tx_cfg[i].action = CYHAL_DMA_TRANSFER_FULL;
+    }
+
+    if (rx_data > 0u)
+    {
+        rx_cfg[rx_segments].dst_addr = (uint32_t)obj->dma_rx_buff;
+        rx_cfg[rx_segments].dst_increment = 1;
+        rx_cfg[rx_segments].length = rx_data;
+        rx_segments++;
+    }
+    if (block > rx_data)
+    {
+        rx_cfg[rx_segments].dst_addr = (uint32_t)&obj->dma_sink;
+        rx_cfg[rx_segments].dst_increment = 0;
+        rx_cfg[rx_segments].length = block - rx_data;
+        rx_segments++;
+    }
+    for (size_t i = 0u; i < rx_segments; i++)
+    {
+        rx_cfg[i].src_addr = (uint32_t)&obj->base->RX_FIFO_RD;
+        rx_cfg[i].src_increment = 0;
+        rx_cfg[i].transfer_width = width;
+        /* The RX trigger fires for every received element, so the tail of the block never stalls */
+        rx_cfg[i].burst_size = 1u;
+        rx_cfg[i].action = CYHAL_DMA_TRANSFER_FULL;
+    }
+
+    obj->dma_tx_buff += tx_data * (width / 8u);
+    obj->dma_tx_length -= tx_data;
+    obj->dma_rx_buff += rx_data * (width / 8u);
+    obj->dma_rx_length -= rx_data;
+    obj->dma_length -= block;
+
+    cy_rslt_t result = cyhal_dma_configure_chain(&(obj->dma_rx), rx_cfg, rx_segments, &(obj->dma_rx_lli));
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_dma_enable_event(&(obj->dma_rx), CYHAL_DMA_TRANSFER_COMPLETE, CYHAL_DMA_PRIORITY_DEFAULT, true);
+        result = cyhal_dma_configure_chain(&(obj->dma_tx), tx_cfg, tx_segments, &(obj->dma_tx_lli));
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        cyhal_dma_enable_event(&(obj->dma_tx), CYHAL_DMA_TRANSFER_COMPLETE, CYHAL_DMA_PRIORITY_DEFAULT, true);
+        result = cyhal_dma_enable(&(obj->dma_rx));
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cyhal_dma_enable(&(obj->dma_tx));
+    }
+
+    /* The receive side must own its channel before any clocks are generated, otherwise the RX FIFO
+     * overflows while the request waits behind another SCB on the shared peripheral-to-memory channel.
+     * The transmit side is therefore linked to the receive side and started by the DMA driver as soon
+     * as the receive request has been granted its channel. */
+    if (CY_RSLT_SUCCESS == result)
+    {
+        obj->dma_rx.start_linked = &(obj->dma_tx);
+        result = cyhal_dma_start_transfer(&(obj->dma_rx));
+    }
+
+    return result;
+}
+
+static void _cyhal_spi_dma_handler_tx(void* arg, cyhal_dma_event_t event)
+{
+    cyhal_spi_t* obj = (cyhal_spi_t*)arg;
+    CY_ASSERT(CYHAL_ASYNC_DMA == obj->async_mode);
+
+    /* Completion is reported by the RX side, which finishes last */
+    if ((CYHAL_DMA_TRANSFER_COMPLETE != event) && (_CYHAL_SPI_PENDING_NONE != obj->pending))
+    {
+        (void)cyhal_dma_disable(&(obj->dma_rx));
+        _cyhal_spi_dma_finish(obj, CYHAL_SPI_IRQ_ERROR);
+    }
+}
+
+static void _cyhal_spi_dma_handler_rx(void* arg, cyhal_dma_event_t event)
+{
+    cyhal_spi_t* obj = (cyhal_spi_t*)arg;
+    CY_ASSERT(CYHAL_ASYNC_DMA == obj->async_mode);
+
+    if (_CYHAL_SPI_PENDING_NONE == obj->pending)
+    {
+        return;
+    }
+
+    if (CYHAL_DMA_TRANSFER_COMPLETE != event)
+    {
+        (void)cyhal_dma_disable(&(obj->dma_tx));
+        _cyhal_spi_dma_finish(obj, CYHAL_SPI_IRQ_ERROR);
+    }
+    else if (obj->dma_length > 0u)
+    {
+        /* Setup another block if we're expecting more */
+        if (CY_RSLT_SUCCESS != _cyhal_spi_dma_start_block(obj))
+        {
+            _cyhal_spi_dma_finish(obj, CYHAL_SPI_IRQ_ERROR);
+        }
+    }
+    else
+    {
+        _cyhal_spi_dma_finish(obj, CYHAL_SPI_IRQ_DONE);
+    }
+}
+
+static cy_rslt_t _cyhal_spi_dma_transfer_async(cyhal_spi_t *obj, const uint8_t *tx, size_t tx_length, uint8_t *rx, size_t rx_length)
+{
+    size_t length = (tx_length > rx_length) ? tx_length : rx_length;
+    if ((0u == length) || ((0u != tx_length) && (NULL == tx)) || ((0u != rx_length) && (NULL == rx)))
+    {
+        return CYHAL_SPI_RSLT_BAD_ARGUMENT;
+    }
+    if (_CYHAL_SPI_PENDING_NONE != obj->pending)
+    {
+        return CYHAL_SPI_RSLT_TRANSFER_ERROR;
+    }
+
+    obj->dma_tx_buff = tx;
+    obj->dma_tx_length = tx_length;
+    obj->dma_rx_buff = rx;
+    obj->dma_rx_length = rx_length;
+    obj->dma_length = length;
+    obj->dma_fill = obj->write_fill;
+    obj->pending = (0u == rx_length) ? _CYHAL_SPI_PENDING_TX
+        : ((0u == tx_length) ? _CYHAL_SPI_PENDING_RX : _CYHAL_SPI_PENDING_TX_RX);
+
+    _cyhal_ssel_switch_state(obj, obj->active_ssel, _CYHAL_SPI_SSEL_ACTIVATE);
+    cy_rslt_t result = _cyhal_spi_dma_start_block(obj);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        obj->dma_tx_buff = NULL;
+        obj->dma_rx_buff = NULL;
+        obj->dma_length = 0u;
+        obj->pending = _CYHAL_SPI_PENDING_NONE;
+        _cyhal_ssel_switch_state(obj, obj->active_ssel, _CYHAL_SPI_SSEL_DEACTIVATE);
+    }
+    return result;
+}
+#endif /* (CYHAL_DRIVER_AVAILABLE_DMA) */
+
 static cy_en_scb_spi_sclk_mode_t _cyhal_convert_mode_sclk(cyhal_spi_mode_t mode)
 {
     uint8_t sclk_mode = (mode & (CYHAL_SPI_MODE_FLAG_CPOL | CYHAL_SPI_MODE_FLAG_CPHA));
@@ -644,6 +875,12 @@ static cy_rslt_t _cyhal_spi_setup_resources(cyhal_spi_t *obj, cyhal_gpio_t mosi,
     obj->pending = _CYHAL_SPI_PENDING_NONE;
     obj->write_fill = (uint8_t) CY_SCB_SPI_DEFAULT_TX;
     obj->oversample_value = _CYHAL_SPI_OVERSAMPLE_MIN;
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    obj->async_mode = CYHAL_ASYNC_SW;
+    obj->dma_tx.resource.type = CYHAL_RSC_INVALID;
+    obj->dma_rx.resource.type = CYHAL_RSC_INVALID;
+    obj->dma_length = 0u;
+    #endif
 
     obj->pin_mosi = NC;
     obj->pin_miso = NC;
@@ -1088,6 +1325,12 @@ cy_rslt_t cyhal_spi_init_cfg(cyhal_spi_t *obj, const cyhal_spi_configurator_t *c
     obj->active_ssel = 0;
     obj->is_slave = is_slave;
     obj->write_fill = (uint8_t) CY_SCB_SPI_DEFAULT_TX;
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    obj->async_mode = CYHAL_ASYNC_SW;
+    obj->dma_tx.resource.type = CYHAL_RSC_INVALID;
+    obj->dma_rx.resource.type = CYHAL_RSC_INVALID;
+    obj->dma_length = 0u;
+    #endif
 
     //Copy pins from configurator object
     obj->pin_mosi = cfg->gpios.mosi;
@@ -1178,6 +1421,19 @@ cy_rslt_t cyhal_spi_init_cfg(cyhal_spi_t *obj, const cyhal_spi_configurator_t *c
 
 void cyhal_spi_free(cyhal_spi_t *obj)
 {
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if (CYHAL_RSC_INVALID != obj->dma_tx.resource.type)
+    {
+        cyhal_dma_free(&obj->dma_tx);
+        obj->dma_tx.resource.type = CYHAL_RSC_INVALID;
+    }
+    if (CYHAL_RSC_INVALID != obj->dma_rx.resource.type)
+    {
+        cyhal_dma_free(&obj->dma_rx);
+        obj->dma_rx.resource.type = CYHAL_RSC_INVALID;
+    }
+    #endif
+
     if (NULL != obj->base)
     {
         _cyhal_scb_update_instance_data(obj->resource.block_num, NULL, NULL);
@@ -1479,6 +1735,13 @@ cy_rslt_t cyhal_spi_transfer_async(cyhal_spi_t *obj, const uint8_t *tx, size_t t
     if (_cyhal_scb_pm_transition_pending())
         return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
 
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if (CYHAL_ASYNC_DMA == obj->async_mode)
+    {
+        return _cyhal_spi_dma_transfer_async(obj, tx, tx_length, rx, rx_length);
+    }
+    #endif
+
     cy_en_scb_spi_status_t spi_status;
 
     _cyhal_ssel_switch_state(obj, obj->active_ssel, _CYHAL_SPI_SSEL_ACTIVATE);
@@ -1595,11 +1858,125 @@ cy_rslt_t cyhal_spi_abort_async(cyhal_spi_t *obj)
         return CYHAL_SPI_RSLT_BAD_ARGUMENT;
     }
 
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if (CYHAL_ASYNC_DMA == obj->async_mode)
+    {
+        uint32_t saved_intr_status = cyhal_system_critical_section_enter();
+        if (_CYHAL_SPI_PENDING_NONE != obj->pending)
+        {
+            (void)cyhal_dma_disable(&(obj->dma_tx));
+            (void)cyhal_dma_disable(&(obj->dma_rx));
+            obj->dma_tx_buff = NULL;
+            obj->dma_rx_buff = NULL;
+            obj->dma_length = 0u;
+            _cyhal_ssel_switch_state(obj, obj->active_ssel, _CYHAL_SPI_SSEL_DEACTIVATE);
+        }
+        obj->pending = _CYHAL_SPI_PENDING_NONE;
+        cyhal_system_critical_section_exit(saved_intr_status);
+        Cy_SCB_ClearTxFifo(obj->base);
+        Cy_SCB_ClearRxFifo(obj->base);
+        return CY_RSLT_SUCCESS;
+    }
+    #endif
+
     Cy_SCB_SPI_AbortTransfer(obj->base, &(obj->context));
     obj->pending = _CYHAL_SPI_PENDING_NONE;
     return CY_RSLT_SUCCESS;
 }
 
+cy_rslt_t cyhal_spi_set_async_mode(cyhal_spi_t *obj, cyhal_async_mode_t mode, uint8_t dma_priority)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (_cyhal_scb_pm_transition_pending())
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+
+    if (_CYHAL_SPI_PENDING_NONE != obj->pending)
+    {
+        return CYHAL_SPI_RSLT_TRANSFER_ERROR;
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+
+    if (mode == CYHAL_ASYNC_DMA)
+    {
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+        if (obj->is_slave)
+        {
+            return CYHAL_SPI_RSLT_ERR_UNSUPPORTED;
+        }
+
+        uint8_t scb_arr_index = _cyhal_scb_get_block_index(obj->resource.block_num);
+
+        /* Setup DMA for TX */
+        if (CYHAL_RSC_INVALID == obj->dma_tx.resource.type)
+        {
+            cyhal_dma_dest_t dma_dest_tx =
+            {
+                .output = CYHAL_DMA_OUTPUT_TRIGGER_ALL_ELEMENTS,
+                .dest = _cyhal_spi_dma_tx_trigger[scb_arr_index],
+            };
+            /* Set the DMA to correct direction and connect appropriate triggers */
+            result = cyhal_dma_init_adv(&(obj->dma_tx), NULL, &dma_dest_tx, NULL, dma_priority, CYHAL_DMA_DIRECTION_MEM2PERIPH);
+        }
+        if (CY_RSLT_SUCCESS == result)
+        {
+            cyhal_dma_register_callback(&(obj->dma_tx), &_cyhal_spi_dma_handler_tx, obj);
+        }
+
+        /* Setup DMA for RX */
+        if ((CY_RSLT_SUCCESS == result) && (CYHAL_RSC_INVALID == obj->dma_rx.resource.type))
+        {
+            cyhal_dma_src_t dma_src_rx =
+            {
+                .source = _cyhal_spi_dma_rx_trigger[scb_arr_index],
+                .input = CYHAL_DMA_INPUT_TRIGGER_ALL_ELEMENTS,
+            };
+            /* Set the DMA to correct direction and connect appropriate triggers */
+            result = cyhal_dma_init_adv(&(obj->dma_rx), &dma_src_rx, NULL, NULL, dma_priority, CYHAL_DMA_DIRECTION_PERIPH2MEM);
+        }
+        if (CY_RSLT_SUCCESS == result)
+        {
+            cyhal_dma_register_callback(&(obj->dma_rx), &_cyhal_spi_dma_handler_rx, obj);
+
+            /* TX requests a burst whenever half of the FIFO is free, RX requests every received element */
+            (void)_cyhal_scb_set_fifo_level(obj->base, CYHAL_SCB_FIFO_TX, (uint16_t)(Cy_SCB_GetFifoSize(obj->base) / 2u));
+            (void)_cyhal_scb_set_fifo_level(obj->base, CYHAL_SCB_FIFO_RX, 0u);
+        }
+    #else
+        CY_UNUSED_PARAMETER(dma_priority);
+        result = CYHAL_SPI_RSLT_ERR_UNSUPPORTED; // DMA not supported
+    #endif
+    }
+
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if ((mode != CYHAL_ASYNC_DMA) || (CY_RSLT_SUCCESS != result))
+    {
+        /* Free the DMA instances if we reserved them but don't need them anymore */
+        if (CYHAL_ASYNC_DMA == obj->async_mode)
+        {
+            // Restore FIFO levels for SW mode.  Values taken from _cyhal_spi_default_config
+            (void)_cyhal_scb_set_fifo_level(obj->base, CYHAL_SCB_FIFO_TX, _cyhal_spi_default_config.txFifoTriggerLevel);
+            (void)_cyhal_scb_set_fifo_level(obj->base, CYHAL_SCB_FIFO_RX, _cyhal_spi_default_config.rxFifoTriggerLevel);
+        }
+        if (CYHAL_RSC_INVALID != obj->dma_tx.resource.type)
+        {
+            cyhal_dma_free(&obj->dma_tx);
+            obj->dma_tx.resource.type = CYHAL_RSC_INVALID;
+        }
+        if (CYHAL_RSC_INVALID != obj->dma_rx.resource.type)
+        {
+            cyhal_dma_free(&obj->dma_rx);
+            obj->dma_rx.resource.type = CYHAL_RSC_INVALID;
+        }
+        mode = CYHAL_ASYNC_SW;
+    }
+
+    obj->async_mode = mode;
+    #endif
+    return result;
+}
+
 void cyhal_spi_register_callback(cyhal_spi_t *obj, cyhal_spi_event_callback_t callback, void *callback_arg)
 {
     uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
@@ -134,12 +134,15 @@ static const _cyhal_audioss_interface_t _cyhal_tdm_interface =
     .event_mask_full = CYHAL_TDM_RX_FULL,
     .event_mask_half_full = CYHAL_TDM_RX_HALF_FULL,
     .event_rx_complete = CYHAL_TDM_ASYNC_RX_COMPLETE,
+    .event_rx_overflow = CYHAL_TDM_RX_OVERFLOW,
 #endif
     .event_tx_complete = CYHAL_TDM_ASYNC_TX_COMPLETE,
+    .event_tx_underflow = CYHAL_TDM_TX_UNDERFLOW,
     .err_invalid_pin = CYHAL_TDM_RSLT_ERR_INVALID_PIN,
     .err_invalid_arg = CYHAL_TDM_RSLT_ERR_INVALID_ARG,
     .err_clock = CYHAL_TDM_RSLT_ERR_CLOCK,
     .err_not_supported = CYHAL_TDM_RSLT_NOT_SUPPORTED,
+    .err_busy = CYHAL_TDM_RSLT_ERR_BUSY,
 };
 
 cy_rslt_t cyhal_tdm_init(cyhal_tdm_t *obj, const cyhal_tdm_pins_t* tx_pins, const cyhal_tdm_pins_t* rx_pins,
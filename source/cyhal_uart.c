@@ -34,6 +34,7 @@
 #include "cyhal_hwmgr.h"
 #include "cyhal_syspm.h"
 #include "cyhal_clock.h"
+#include "cyhal_timer.h"
 #if (CYHAL_DRIVER_AVAILABLE_DMA)
 #include "cyhal_dma.h"
 #endif
@@ -149,6 +150,10 @@ static const cy_stc_scb_uart_config_t _cyhal_uart_default_config = {
  * IRQ handler when we are able to determine what it is */
 static volatile cyhal_uart_t* _cyhal_uart_irq_obj = NULL;
 
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+static void _cyhal_uart_dma_ring_trigger(cyhal_uart_t *obj);
+#endif
+
 #if defined (COMPONENT_CAT5)
 static void _cyhal_uart_irq_handler(_cyhal_system_irq_t irqn)
 #else
@@ -242,7 +247,16 @@ static void _cyhal_uart_irq_handler(void)
         when processing CY_SCB_RX_INTR_LEVEL. Do not clear the interrupt. */
     if (0UL != (CY_SCB_UART_RX_TRIGGER & rxMasked))
     {
+#if (CYHAL_DRIVER_AVAILABLE_DMA)
+        if (NULL != obj->dma_ring)
+        {
+            /* The DMA receive ring uses the trigger to start each chunk */
+            _cyhal_uart_dma_ring_trigger(obj);
+        }
+        else if (NULL != obj->context.cbEvents)
+#else
         if (NULL != obj->context.cbEvents)
+#endif
         {
             // Need to shift by 1 due to to existing logic in _cyhal_utils_convert_flags()
             obj->context.cbEvents(CYHAL_UART_IRQ_RX_FIFO >> 1u);
@@ -275,7 +289,28 @@ static void _cyhal_uart2_irq_handler(void)
 static CY_SCB_IRQ_THREAD_CB_t _cyhal_irq_cb[3] = {_cyhal_uart0_irq_handler, _cyhal_uart1_irq_handler, _cyhal_uart2_irq_handler};
 #endif
 
+static bool _cyhal_uart_tx_queue_element_done(cyhal_uart_t *obj);
+
 #if (CYHAL_DRIVER_AVAILABLE_DMA)
+#if defined(COMPONENT_CAT5)
+/* Maximum number of elements in one DMA segment */
+#define _CYHAL_UART_DMA_MAX_LENGTH              (4095u)
+
+static const cyhal_dest_t _cyhal_uart_dma_tx_trigger[] =
+{
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB0_TX,
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB1_TX,
+    CYHAL_TRIGGER_DMAC_MEM_TO_SCB2_TX,
+};
+
+static const cyhal_source_t _cyhal_uart_dma_rx_trigger[] =
+{
+    CYHAL_TRIGGER_DMAC_SCB0_RX_TO_MEM,
+    CYHAL_TRIGGER_DMAC_SCB1_RX_TO_MEM,
+    CYHAL_TRIGGER_DMAC_SCB2_RX_TO_MEM,
+};
+#endif
+
 cy_rslt_t _cyhal_uart_dma_write_async(cyhal_uart_t *obj);
 
 static void _cyhal_uart_dma_handler_tx(void* arg, cyhal_dma_event_t event)
@@ -293,6 +328,11 @@ static void _cyhal_uart_dma_handler_tx(void* arg, cyhal_dma_event_t event)
     else
     {
         obj->async_tx_buff = NULL;
+        if(obj->tx_queue_busy && _cyhal_uart_tx_queue_element_done(obj))
+        {
+            /* The next queued buffer has been started */
+            return;
+        }
         /* We may have lowered the FIFO to complete a small transfer. Restore it */
         if(obj->user_fifo_level != ((SCB_TX_FIFO_CTRL(obj->base) & SCB_TX_FIFO_CTRL_TRIGGER_LEVEL_Msk)))
         {
@@ -375,8 +415,17 @@ static void _cyhal_uart_cb_wrapper(uint32_t event)
     /* Safe to cast away volatile because we don't expect this pointer to be changed while we're in here, they
      * just might change where the original pointer points */
     cyhal_uart_t *obj = (cyhal_uart_t*)_cyhal_uart_irq_obj;
+    if ((0UL != (event & CY_SCB_UART_TRANSMIT_DONE_EVENT)) && obj->tx_queue_busy
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+        && (CYHAL_ASYNC_SW == obj->async_mode)
+    #endif
+        && _cyhal_uart_tx_queue_element_done(obj))
+    {
+        /* The next queued buffer has been started, so the transmitter is not done yet */
+        hal_event &= ~((uint32_t)CYHAL_UART_IRQ_TX_DONE);
+    }
     cyhal_uart_event_t anded_events = (cyhal_uart_event_t)(obj->irq_cause & hal_event);
-    if (anded_events)
+    if (anded_events && (NULL != obj->callback_data.callback))
     {
         cyhal_uart_event_callback_t callback = (cyhal_uart_event_callback_t) obj->callback_data.callback;
         callback(obj->callback_data.callback_arg, anded_events);
@@ -940,6 +989,17 @@ void cyhal_uart_free(cyhal_uart_t *obj)
     #if (CYHAL_DRIVER_AVAILABLE_DMA)
     if(obj->async_mode == CYHAL_ASYNC_DMA)
     {
+        if(NULL != obj->dma_ring)
+        {
+            if(NULL != obj->dma_ring_timer)
+            {
+                (void)cyhal_timer_stop(obj->dma_ring_timer);
+                cyhal_timer_enable_event(obj->dma_ring_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, false);
+                obj->dma_ring_timer = NULL;
+            }
+            (void)cyhal_dma_disable(&(obj->dma_rx));
+            obj->dma_ring = NULL;
+        }
         if(CYHAL_RSC_INVALID != obj->dma_tx.resource.type)
         {
             cyhal_dma_free(&obj->dma_tx);
@@ -1229,7 +1289,7 @@ cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode,
         return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
 
     #if (CYHAL_DRIVER_AVAILABLE_DMA)
-    if((obj->async_tx_buff != NULL) || (obj->async_rx_buff != NULL))
+    if((obj->async_tx_buff != NULL) || (obj->async_rx_buff != NULL) || (obj->dma_ring != NULL) || (obj->tx_queue_head != NULL))
     {
         return CYHAL_DMA_RSLT_ERR_CHANNEL_BUSY;
     }
@@ -1247,6 +1307,19 @@ cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode,
         else
         {
             /* Setup DMA for TX */
+            #if defined(COMPONENT_CAT5)
+            /* Use the DMAC request lines of the SCB so the DMA is paced by the FIFO levels */
+            uint8_t scb_arr_index = _cyhal_scb_get_block_index(obj->resource.block_num);
+            if(CYHAL_RSC_INVALID == obj->dma_tx.resource.type && obj->pin_tx != CYHAL_NC_PIN_VALUE)
+            {
+                cyhal_dma_dest_t dma_dest_tx =
+                {
+                    .output = CYHAL_DMA_OUTPUT_TRIGGER_ALL_ELEMENTS,
+                    .dest = _cyhal_uart_dma_tx_trigger[scb_arr_index],
+                };
+                result = cyhal_dma_init_adv(&(obj->dma_tx), NULL, &dma_dest_tx, NULL, dma_priority, CYHAL_DMA_DIRECTION_MEM2PERIPH);
+            }
+            #else
             if(CYHAL_RSC_INVALID == obj->dma_tx.resource.type && obj->pin_tx != CYHAL_NC_PIN_VALUE)
             {
                 cyhal_source_t source_tx;
@@ -1260,9 +1333,21 @@ cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode,
                 /* Set the DMA to correct direction and connect appropriate triggers */
                 result = cyhal_dma_init_adv(&(obj->dma_tx), &dma_src_tx, NULL, NULL, dma_priority, CYHAL_DMA_DIRECTION_MEM2PERIPH);
             }
+            #endif
             cyhal_dma_register_callback(&(obj->dma_tx), &_cyhal_uart_dma_handler_tx, obj);
 
             /* Setup DMA for RX */
+            #if defined(COMPONENT_CAT5)
+            if(CYHAL_RSC_INVALID == obj->dma_rx.resource.type && obj->pin_rx != CYHAL_NC_PIN_VALUE)
+            {
+                cyhal_dma_src_t dma_src_rx =
+                {
+                    .source = _cyhal_uart_dma_rx_trigger[scb_arr_index],
+                    .input = CYHAL_DMA_INPUT_TRIGGER_ALL_ELEMENTS,
+                };
+                cyhal_dma_init_adv(&(obj->dma_rx), &dma_src_rx, NULL, NULL, dma_priority, CYHAL_DMA_DIRECTION_PERIPH2MEM);
+            }
+            #else
             if(CYHAL_RSC_INVALID == obj->dma_rx.resource.type && obj->pin_rx != CYHAL_NC_PIN_VALUE)
             {
                 cyhal_source_t source_rx;
@@ -1276,6 +1361,7 @@ cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode,
                 /* Set the DMA to correct direction and connect appropriate triggers */
                 cyhal_dma_init_adv(&(obj->dma_rx), &dma_src_rx, NULL, NULL, dma_priority, CYHAL_DMA_DIRECTION_PERIPH2MEM);
             }
+            #endif
             cyhal_dma_register_callback(&(obj->dma_rx), &_cyhal_uart_dma_handler_rx, obj);
 
             // Default RTS level (20 or 3) may lead to DMA waiting for more data before reading and RTS waiting for data read
@@ -1318,6 +1404,82 @@ cy_rslt_t cyhal_uart_set_async_mode(cyhal_uart_t *obj, cyhal_async_mode_t mode,
 }
 
 #if (CYHAL_DRIVER_AVAILABLE_DMA)
+#if defined(COMPONENT_CAT5)
+cy_rslt_t _cyhal_uart_dma_write_async(cyhal_uart_t *obj)
+{
+    if(cyhal_dma_is_busy(&(obj->dma_tx)))
+    {
+        return CYHAL_DMA_RSLT_ERR_CHANNEL_BUSY;
+    }
+
+    CY_ASSERT(NULL != obj->async_tx_buff);
+
+    /* Describe as much of the buffer as the linked list items allow, so that a long write costs a
+     * single completion interrupt. The DMA keeps the FIFO topped up through the TX request line. */
+    uint32_t mem_width = (obj->config.dataWidth <= CY_SCB_BYTE_WIDTH) ? 8 : 16;
+    cyhal_dma_cfg_t dma_config[_CYHAL_UART_DMA_TX_LLI + 1u];
+    size_t segments = 0u;
+    uint32_t remaining = obj->async_tx_length;
+    uint8_t *src = (uint8_t *)obj->async_tx_buff;
+    cyhal_uart_tx_request_t *req = obj->tx_queue_head;
+    while(segments < (_CYHAL_UART_DMA_TX_LLI + 1u))
+    {
+        if(0u == remaining)
+        {
+            /* Chain the following buffers of a scatter/gather request as well. The request is left
+             * on the last buffer described, which completes with the transfer. */
+            size_t next = (NULL != req) ? (req->iov_index + 1u) : 0u;
+            while((NULL != req) && (next < req->iov_count) && (0u == req->iov[next].length))
+            {
+                next++;
+            }
+            if((NULL == req) || (next >= req->iov_count))
+            {
+                break;
+            }
+            req->iov_index = next;
+            src = (uint8_t *)req->iov[next].buffer;
+            remaining = req->iov[next].length;
+        }
+
+        uint32_t length = (remaining > _CYHAL_UART_DMA_MAX_LENGTH) ? _CYHAL_UART_DMA_MAX_LENGTH : remaining;
+        dma_config[segments].src_addr = (uint32_t)src;
+        dma_config[segments].src_increment = 1;
+        dma_config[segments].dst_addr = (uint32_t)&obj->base->TX_FIFO_WR;
+        dma_config[segments].dst_increment = 0;
+        dma_config[segments].length = length;
+        dma_config[segments].transfer_width = mem_width;
+        dma_config[segments].burst_size = CYHAL_DMA_BURST_SIZE_AUTO;
+        dma_config[segments].action = CYHAL_DMA_TRANSFER_FULL;
+        src += length * (mem_width / 8);
+        remaining -= length;
+        segments++;
+    }
+
+    /* Move next src up and keep track of how much data has already been sent */
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    obj->async_tx_buff = src;
+    obj->async_tx_length = remaining;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    /* Request a burst whenever at least half of the FIFO is free; AUTO bursts never exceed that */
+    cy_rslt_t result = _cyhal_scb_set_fifo_level(obj->base, (cyhal_scb_fifo_type_t)CYHAL_UART_FIFO_TX, Cy_SCB_GetFifoSize(obj->base) / 2);
+    if(result == CY_RSLT_SUCCESS)
+    {
+        result = cyhal_dma_configure_chain(&(obj->dma_tx), dma_config, segments, obj->dma_tx_lli);
+    }
+    if(result == CY_RSLT_SUCCESS)
+    {
+        cyhal_dma_enable_event(&(obj->dma_tx), CYHAL_DMA_TRANSFER_COMPLETE, CYHAL_DMA_PRIORITY_DEFAULT, true);
+        result = cyhal_dma_enable(&(obj->dma_tx));
+    }
+    if(result == CY_RSLT_SUCCESS)
+    {
+        result = cyhal_dma_start_transfer(&(obj->dma_tx));
+    }
+    return result;
+}
+#else
 cy_rslt_t _cyhal_uart_dma_write_async(cyhal_uart_t *obj)
 {
     if(cyhal_dma_is_busy(&(obj->dma_tx)))
@@ -1343,7 +1505,11 @@ cy_rslt_t _cyhal_uart_dma_write_async(cyhal_uart_t *obj)
         .dst_increment = 0,
         .length = length,
         .transfer_width = mem_width,
+#if defined(COMPONENT_CAT5)
+        .burst_size = CYHAL_DMA_BURST_SIZE_AUTO,
+#else
         .burst_size = 0,
+#endif
         .action = CYHAL_DMA_TRANSFER_FULL_DISABLE,
     };
 
@@ -1369,6 +1535,7 @@ cy_rslt_t _cyhal_uart_dma_write_async(cyhal_uart_t *obj)
     }
     return result;
 }
+#endif /* defined(COMPONENT_CAT5) */
 #endif
 
 cy_rslt_t cyhal_uart_write_async(cyhal_uart_t *obj, void *tx, size_t length)
@@ -1376,6 +1543,9 @@ cy_rslt_t cyhal_uart_write_async(cyhal_uart_t *obj, void *tx, size_t length)
     if (_cyhal_scb_pm_transition_pending())
         return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
 
+    if (NULL != obj->tx_queue_head)
+        return (cy_rslt_t)CY_SCB_UART_TRANSMIT_BUSY;
+
     cy_rslt_t result;
     #if (CYHAL_DRIVER_AVAILABLE_DMA)
     if(obj->async_mode == CYHAL_ASYNC_DMA)
@@ -1394,6 +1564,150 @@ cy_rslt_t cyhal_uart_write_async(cyhal_uart_t *obj, void *tx, size_t length)
     return result;
 }
 
+/*******************************************************************************
+*       Scatter/gather write queue
+*******************************************************************************/
+
+/* Hands the current element of the request at the head of the TX queue to the hardware */
+static cy_rslt_t _cyhal_uart_tx_queue_start(cyhal_uart_t *obj)
+{
+    cyhal_uart_tx_request_t *req = obj->tx_queue_head;
+    const cyhal_uart_iovec_t *iov = &(req->iov[req->iov_index]);
+    cy_rslt_t result;
+    #if (CYHAL_DRIVER_AVAILABLE_DMA)
+    if(obj->async_mode == CYHAL_ASYNC_DMA)
+    {
+        obj->async_tx_buff = (void *)iov->buffer;
+        obj->async_tx_length = iov->length;
+        result = _cyhal_uart_dma_write_async(obj);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            obj->async_tx_buff = NULL;
+        }
+    }
+    else
+    #endif
+    {
+        result = (cy_rslt_t)Cy_SCB_UART_Transmit(obj->base, (void *)iov->buffer, iov->length, &(obj->context));
+    }
+    if (CY_RSLT_SUCCESS == result)
+    {
+        obj->tx_queue_busy = true;
+    }
+    return result;
+}
+
+/* Removes the request at the head of the TX queue and reports its completion */
+static void _cyhal_uart_tx_queue_finish(cyhal_uart_t *obj, cyhal_uart_event_t event)
+{
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    cyhal_uart_tx_request_t *req = obj->tx_queue_head;
+    obj->tx_queue_head = req->next;
+    if (NULL == obj->tx_queue_head)
+    {
+        obj->tx_queue_tail = NULL;
+    }
+    req->next = NULL;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    cyhal_uart_event_callback_t callback = (cyhal_uart_event_callback_t)req->callback_data.callback;
+    if (NULL != callback)
+    {
+        callback(req->callback_data.callback_arg, event);
+    }
+}
+
+/* Starts the next non-empty element in the TX queue, completing requests that have been fully
+ * sent and failing those that cannot be started. Stops early if a completion callback has already
+ * started a newly submitted request. */
+static void _cyhal_uart_tx_queue_service(cyhal_uart_t *obj)
+{
+    while ((NULL != obj->tx_queue_head) && !obj->tx_queue_busy)
+    {
+        cyhal_uart_tx_request_t *req = obj->tx_queue_head;
+        while ((req->iov_index < req->iov_count) && (0u == req->iov[req->iov_index].length))
+        {
+            req->iov_index++;
+        }
+
+        if (req->iov_index == req->iov_count)
+        {
+            _cyhal_uart_tx_queue_finish(obj, CYHAL_UART_IRQ_TX_TRANSMIT_IN_FIFO);
+        }
+        else if (CY_RSLT_SUCCESS != _cyhal_uart_tx_queue_start(obj))
+        {
+            _cyhal_uart_tx_queue_finish(obj, CYHAL_UART_IRQ_TX_ERROR);
+        }
+    }
+}
+
+/* Called from interrupt context once the element in flight has been sent. Returns true if
+ * another element has been started. */
+static bool _cyhal_uart_tx_queue_element_done(cyhal_uart_t *obj)
+{
+    obj->tx_queue_busy = false;
+    obj->tx_queue_head->iov_index++;
+    _cyhal_uart_tx_queue_service(obj);
+    return obj->tx_queue_busy;
+}
+
+cy_rslt_t cyhal_uart_writev_async(cyhal_uart_t *obj, cyhal_uart_tx_request_t *req, const cyhal_uart_iovec_t *iov,
+                                  size_t count, cyhal_uart_event_callback_t callback, void *callback_arg)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != req);
+    CY_ASSERT((NULL != iov) || (0u == count));
+
+    if (_cyhal_scb_pm_transition_pending())
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+
+    /* Skip leading empty buffers so that a request always has data to start with */
+    size_t first = 0u;
+    while ((first < count) && (0u == iov[first].length))
+    {
+        first++;
+    }
+    if (first == count)
+    {
+        return CYHAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+
+    req->iov = iov;
+    req->iov_count = count;
+    req->iov_index = first;
+    req->callback_data.callback = (cy_israddress)callback;
+    req->callback_data.callback_arg = callback_arg;
+    req->next = NULL;
+
+    /* SW mode sends the next buffer from the transmit done event of the PDL */
+    if (NULL == obj->context.cbEvents)
+    {
+        Cy_SCB_UART_RegisterCallback(obj->base, _cyhal_uart_cb_wrapper, &(obj->context));
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if (NULL == obj->tx_queue_head)
+    {
+        obj->tx_queue_head = req;
+        obj->tx_queue_tail = req;
+        result = _cyhal_uart_tx_queue_start(obj);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            /* Drop the failed request without calling back */
+            obj->tx_queue_head = NULL;
+            obj->tx_queue_tail = NULL;
+        }
+    }
+    else
+    {
+        obj->tx_queue_tail->next = req;
+        obj->tx_queue_tail = req;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return result;
+}
+
 #if (CYHAL_DRIVER_AVAILABLE_DMA)
 cy_rslt_t _cyhal_uart_dma_read_async(cyhal_uart_t *obj)
 {
@@ -1410,6 +1724,17 @@ cy_rslt_t _cyhal_uart_dma_read_async(cyhal_uart_t *obj)
     {
         length = (Cy_SCB_GetFifoSize(obj->base) / 2);
     }
+#if defined(COMPONENT_CAT5)
+    /* The FIFO stops requesting once fewer elements than the trigger level are left in it, so each
+     * transfer is a single burst that is requested once it is entirely in the FIFO. Round the length
+     * down to a supported burst size; the remainder is read by the following, smaller, transfers. */
+    uint32_t burst = 1u;
+    for(uint32_t size = 4u; size <= length; size <<= 1)
+    {
+        burst = size;
+    }
+    length = burst;
+#endif
 
     uint32_t mem_width = (obj->config.dataWidth <= CY_SCB_BYTE_WIDTH) ? 8 : 16;
     cyhal_dma_cfg_t dma_config =
@@ -1420,8 +1745,16 @@ cy_rslt_t _cyhal_uart_dma_read_async(cyhal_uart_t *obj)
         .dst_increment = 1,
         .length = length,
         .transfer_width = mem_width,
+#if defined(COMPONENT_CAT5)
+        .burst_size = CYHAL_DMA_BURST_SIZE_AUTO,
+#else
         .burst_size = 0,
+#endif
+#if defined(COMPONENT_CAT5)
+        .action = CYHAL_DMA_TRANSFER_FULL,
+#else
         .action = CYHAL_DMA_TRANSFER_FULL_DISABLE,
+#endif
     };
 
     /* Move next src up and keep track of how much data has already been sent */
@@ -1445,7 +1778,433 @@ cy_rslt_t _cyhal_uart_dma_read_async(cyhal_uart_t *obj)
     {
         result = cyhal_dma_enable(&(obj->dma_rx));
     }
+    #if defined(COMPONENT_CAT5)
+    if(result == CY_RSLT_SUCCESS)
+    {
+        result = cyhal_dma_start_transfer(&(obj->dma_rx));
+    }
+    #endif
+
+    return result;
+}
+
+/* Masks or unmasks the RX FIFO trigger, which fires once a whole ring chunk is in the FIFO */
+static void _cyhal_uart_dma_ring_wait_chunk(cyhal_uart_t *obj, bool enable)
+{
+    if(enable)
+    {
+        Cy_SCB_ClearRxInterrupt(obj->base, CY_SCB_UART_RX_TRIGGER);
+        Cy_SCB_SetRxInterruptMask(obj->base, Cy_SCB_GetRxInterruptMask(obj->base) | CY_SCB_UART_RX_TRIGGER);
+    }
+    else
+    {
+        Cy_SCB_SetRxInterruptMask(obj->base, Cy_SCB_GetRxInterruptMask(obj->base) & ~CY_SCB_UART_RX_TRIGGER);
+    }
+}
+
+/* Moves the chunk at the write position out of the FIFO. The FIFO already holds the whole chunk,
+ * so the transfer is a single burst and the channel is released as soon as it completes.
+ * Must be called from within a critical section while no chunk is in flight. */
+static cy_rslt_t _cyhal_uart_dma_ring_start_chunk(cyhal_uart_t *obj)
+{
+    cyhal_dma_cfg_t dma_config =
+    {
+        .src_addr = (uint32_t)(&(obj->base->RX_FIFO_RD)),
+        .src_increment = 0,
+        .dst_addr = (uint32_t)(obj->dma_ring + (obj->dma_ring_wr_chunk * CYHAL_UART_DMA_RING_CHUNK)),
+        .dst_increment = 1,
+        .length = CYHAL_UART_DMA_RING_CHUNK,
+        .transfer_width = 8u,
+        .burst_size = CYHAL_UART_DMA_RING_CHUNK,
+        .action = CYHAL_DMA_TRANSFER_FULL,
+    };
+
+    cy_rslt_t result = cyhal_dma_configure(&(obj->dma_rx), &dma_config);
+    if(result == CY_RSLT_SUCCESS)
+    {
+        result = cyhal_dma_enable(&(obj->dma_rx));
+    }
+    if(result == CY_RSLT_SUCCESS)
+    {
+        obj->dma_ring_inflight = true;
+        result = cyhal_dma_start_transfer(&(obj->dma_rx));
+    }
+    if(result != CY_RSLT_SUCCESS)
+    {
+        obj->dma_ring_inflight = false;
+    }
+    return result;
+}
+
+/* Starts the next chunk if it is already in the FIFO and the ring has room for it, otherwise waits
+ * for the FIFO trigger. Must be called from within a critical section while no chunk is in flight. */
+static cy_rslt_t _cyhal_uart_dma_ring_next(cyhal_uart_t *obj)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    if(obj->dma_ring_used >= obj->dma_ring_chunks)
+    {
+        /* The ring is full. Data is held in the HW FIFO until the ring is consumed */
+        _cyhal_uart_dma_ring_wait_chunk(obj, false);
+    }
+    else if(Cy_SCB_UART_GetNumInRxFifo(obj->base) >= CYHAL_UART_DMA_RING_CHUNK)
+    {
+        _cyhal_uart_dma_ring_wait_chunk(obj, false);
+        result = _cyhal_uart_dma_ring_start_chunk(obj);
+    }
+    else
+    {
+        _cyhal_uart_dma_ring_wait_chunk(obj, true);
+    }
+    return result;
+}
+
+/* Moves a tail shorter than a chunk from the FIFO into the chunk at the write position. Must be
+ * called from within a critical section while no chunk is in flight, so no DMA reads the FIFO.
+ * Returns whether a chunk was added to the ring. */
+static bool _cyhal_uart_dma_ring_flush_tail(cyhal_uart_t *obj)
+{
+    uint32_t count = Cy_SCB_UART_GetNumInRxFifo(obj->base);
+
+    /* There must be a free chunk to receive the tail, and room to remember its length */
+    if((count == 0u) || (count >= CYHAL_UART_DMA_RING_CHUNK)
+        || (obj->dma_ring_used >= obj->dma_ring_chunks)
+        || (obj->dma_ring_short_count >= _CYHAL_UART_DMA_RING_MAX_SHORT))
+    {
+        return false;
+    }
+
+    uint32_t chunk = obj->dma_ring_wr_chunk;
+    (void)Cy_SCB_UART_GetArray(obj->base, obj->dma_ring + (chunk * CYHAL_UART_DMA_RING_CHUNK), count);
+
+    uint8_t tail = (obj->dma_ring_short_head + obj->dma_ring_short_count) % _CYHAL_UART_DMA_RING_MAX_SHORT;
+    obj->dma_ring_short[tail].chunk = (uint16_t)chunk;
+    obj->dma_ring_short[tail].length = (uint16_t)count;
+    obj->dma_ring_short_count++;
+    obj->dma_ring_wr_chunk = (chunk + 1u) % obj->dma_ring_chunks;
+    obj->dma_ring_used++;
+    return true;
+}
+
+static void _cyhal_uart_dma_ring_notify(cyhal_uart_t *obj, cyhal_uart_event_t event)
+{
+    cyhal_uart_event_callback_t callback = (cyhal_uart_event_callback_t)obj->callback_data.callback;
+    if((0 != ((cyhal_uart_event_t)obj->irq_cause & event)) && (NULL != callback))
+    {
+        callback(obj->callback_data.callback_arg, event);
+    }
+}
+
+/* Called from the UART interrupt when the RX FIFO trigger fires */
+static void _cyhal_uart_dma_ring_trigger(cyhal_uart_t *obj)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if((NULL != obj->dma_ring) && !obj->dma_ring_inflight)
+    {
+        result = _cyhal_uart_dma_ring_next(obj);
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(result != CY_RSLT_SUCCESS)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_ERROR);
+    }
+}
+
+static void _cyhal_uart_dma_ring_handler(void* arg, cyhal_dma_event_t event)
+{
+    cyhal_uart_t* obj = (cyhal_uart_t*)arg;
+    CY_ASSERT(CYHAL_ASYNC_DMA == obj->async_mode);
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    bool full = false;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if((NULL == obj->dma_ring) || !obj->dma_ring_inflight)
+    {
+        cyhal_system_critical_section_exit(savedIntrStatus);
+        return;
+    }
+    obj->dma_ring_inflight = false;
+
+    if(CYHAL_DMA_TRANSFER_COMPLETE == event)
+    {
+        obj->dma_ring_wr_chunk = (obj->dma_ring_wr_chunk + 1u) % obj->dma_ring_chunks;
+        obj->dma_ring_used++;
+        obj->dma_ring_completed++;
+
+        /* The DMA no longer reads the FIFO, so a flush requested while the chunk was in flight can
+         * take the tail now. If more data arrived meanwhile the tail is moved by the next chunk. */
+        if(obj->dma_ring_flush_pending)
+        {
+            obj->dma_ring_flush_pending = false;
+            (void)_cyhal_uart_dma_ring_flush_tail(obj);
+        }
+        result = _cyhal_uart_dma_ring_next(obj);
+        full = (obj->dma_ring_used >= obj->dma_ring_chunks);
+    }
+    else
+    {
+        (void)cyhal_dma_disable(&(obj->dma_rx));
+        _cyhal_uart_dma_ring_wait_chunk(obj, false);
+        obj->dma_ring_flush_pending = false;
+        result = CYHAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(result != CY_RSLT_SUCCESS)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_ERROR);
+        return;
+    }
+    if(full)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_FULL);
+    }
+    _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_DONE);
+}
+
+/* Flushes the tail once neither the FIFO level nor the ring has changed for a whole timer period */
+static void _cyhal_uart_dma_ring_timer_cb(void *callback_arg, cyhal_timer_event_t event)
+{
+    CY_UNUSED_PARAMETER(event);
+    cyhal_uart_t *obj = (cyhal_uart_t*)callback_arg;
+
+    bool flushed = false;
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if(NULL != obj->dma_ring)
+    {
+        uint32_t count = Cy_SCB_UART_GetNumInRxFifo(obj->base);
+        if((0u != count) && (count == obj->dma_ring_idle_count) && !obj->dma_ring_inflight
+            && (obj->dma_ring_completed == obj->dma_ring_idle_completed))
+        {
+            flushed = _cyhal_uart_dma_ring_flush_tail(obj);
+            if(flushed)
+            {
+                result = _cyhal_uart_dma_ring_next(obj);
+            }
+            count = Cy_SCB_UART_GetNumInRxFifo(obj->base);
+        }
+        obj->dma_ring_idle_count = count;
+        obj->dma_ring_idle_completed = obj->dma_ring_completed;
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(result != CY_RSLT_SUCCESS)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_ERROR);
+    }
+    else if(flushed)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_DONE);
+    }
+}
+
+cy_rslt_t cyhal_uart_dma_ring_start(cyhal_uart_t *obj, uint8_t *ring, size_t size, cyhal_timer_t *idle_timer)
+{
+    CY_ASSERT(NULL != obj);
+
+    if (_cyhal_scb_pm_transition_pending())
+        return CYHAL_SYSPM_RSLT_ERR_PM_PENDING;
+
+    if((CYHAL_ASYNC_DMA != obj->async_mode) || (CYHAL_RSC_INVALID == obj->dma_rx.resource.type)
+        || (obj->config.dataWidth > CY_SCB_BYTE_WIDTH))
+    {
+        return CYHAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    if((NULL == ring) || (0u != (size % CYHAL_UART_DMA_RING_CHUNK)) || ((size / CYHAL_UART_DMA_RING_CHUNK) < 2u))
+    {
+        return CYHAL_UART_RSLT_ERR_UNSUPPORTED_CONFIG;
+    }
+    if((NULL != obj->async_rx_buff) || (NULL != obj->dma_ring))
+    {
+        return CYHAL_DMA_RSLT_ERR_CHANNEL_BUSY;
+    }
+
+    cyhal_dma_register_callback(&(obj->dma_rx), &_cyhal_uart_dma_ring_handler, obj);
+    cyhal_dma_enable_event(&(obj->dma_rx), CYHAL_DMA_TRANSFER_COMPLETE, CYHAL_DMA_PRIORITY_DEFAULT, true);
 
+    /* Trigger once a whole chunk is in the FIFO */
+    cy_rslt_t result = _cyhal_scb_set_fifo_level(obj->base, (cyhal_scb_fifo_type_t)CYHAL_UART_FIFO_RX, CYHAL_UART_DMA_RING_CHUNK - 1u);
+    if(result == CY_RSLT_SUCCESS)
+    {
+        uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+        obj->dma_ring = ring;
+        obj->dma_ring_chunks = size / CYHAL_UART_DMA_RING_CHUNK;
+        obj->dma_ring_rd = 0u;
+        obj->dma_ring_wr_chunk = 0u;
+        obj->dma_ring_used = 0u;
+        obj->dma_ring_inflight = false;
+        obj->dma_ring_flush_pending = false;
+        obj->dma_ring_completed = 0u;
+        obj->dma_ring_timer = idle_timer;
+        obj->dma_ring_idle_count = 0u;
+        obj->dma_ring_idle_completed = 0u;
+        obj->dma_ring_short_head = 0u;
+        obj->dma_ring_short_count = 0u;
+        result = _cyhal_uart_dma_ring_next(obj);
+        cyhal_system_critical_section_exit(savedIntrStatus);
+    }
+    if((result == CY_RSLT_SUCCESS) && (NULL != idle_timer))
+    {
+        cyhal_timer_register_callback(idle_timer, _cyhal_uart_dma_ring_timer_cb, obj);
+        cyhal_timer_enable_event(idle_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, true);
+        result = cyhal_timer_start(idle_timer);
+    }
+
+    if(result != CY_RSLT_SUCCESS)
+    {
+        if(NULL != obj->dma_ring)
+        {
+            (void)cyhal_uart_dma_ring_stop(obj);
+        }
+        else
+        {
+            cyhal_dma_register_callback(&(obj->dma_rx), &_cyhal_uart_dma_handler_rx, obj);
+            _cyhal_scb_set_fifo_level(obj->base, (cyhal_scb_fifo_type_t)CYHAL_UART_FIFO_RX, obj->user_fifo_level);
+        }
+    }
+    return result;
+}
+
+cy_rslt_t cyhal_uart_dma_ring_stop(cyhal_uart_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    if(NULL == obj->dma_ring)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    if(NULL != obj->dma_ring_timer)
+    {
+        (void)cyhal_timer_stop(obj->dma_ring_timer);
+        cyhal_timer_enable_event(obj->dma_ring_timer, CYHAL_TIMER_IRQ_TERMINAL_COUNT, CYHAL_ISR_PRIORITY_DEFAULT, false);
+    }
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if(obj->dma_ring_inflight)
+    {
+        (void)cyhal_dma_disable(&(obj->dma_rx));
+    }
+    /* Keep the trigger if the application enabled the RX FIFO event itself */
+    _cyhal_uart_dma_ring_wait_chunk(obj, 0 != ((cyhal_uart_event_t)obj->irq_cause & CYHAL_UART_IRQ_RX_FIFO));
+    obj->dma_ring = NULL;
+    obj->dma_ring_inflight = false;
+    obj->dma_ring_flush_pending = false;
+    obj->dma_ring_timer = NULL;
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    cyhal_dma_register_callback(&(obj->dma_rx), &_cyhal_uart_dma_handler_rx, obj);
+    return _cyhal_scb_set_fifo_level(obj->base, (cyhal_scb_fifo_type_t)CYHAL_UART_FIFO_RX, obj->user_fifo_level);
+}
+
+/* Returns the number of valid bytes in the given chunk, which must have been completed */
+static uint32_t _cyhal_uart_dma_ring_chunk_length(const cyhal_uart_t *obj, uint32_t chunk)
+{
+    /* Flushed chunks are consumed in order, so only the oldest one can be at the consumer */
+    if(0u != obj->dma_ring_short_count)
+    {
+        const _cyhal_uart_dma_ring_short_t *item = &obj->dma_ring_short[obj->dma_ring_short_head];
+        if(item->chunk == chunk)
+        {
+            return item->length;
+        }
+    }
+    return CYHAL_UART_DMA_RING_CHUNK;
+}
+
+size_t cyhal_uart_dma_ring_peek(cyhal_uart_t *obj, const uint8_t **data)
+{
+    CY_ASSERT(NULL != obj);
+    CY_ASSERT(NULL != data);
+
+    size_t length = 0u;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if(NULL != obj->dma_ring)
+    {
+        uint32_t chunk = obj->dma_ring_rd / CYHAL_UART_DMA_RING_CHUNK;
+        uint32_t offset = obj->dma_ring_rd % CYHAL_UART_DMA_RING_CHUNK;
+        *data = obj->dma_ring + obj->dma_ring_rd;
+
+        /* Gather completed chunks until the end of the ring or the first flushed chunk */
+        for(uint32_t i = 0u; (i < obj->dma_ring_used) && (chunk < obj->dma_ring_chunks); i++, chunk++)
+        {
+            uint32_t chunk_length = _cyhal_uart_dma_ring_chunk_length(obj, chunk);
+            length += chunk_length - offset;
+            offset = 0u;
+            if(chunk_length != CYHAL_UART_DMA_RING_CHUNK)
+            {
+                break;
+            }
+        }
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+    return length;
+}
+
+void cyhal_uart_dma_ring_consume(cyhal_uart_t *obj, size_t length)
+{
+    CY_ASSERT(NULL != obj);
+
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    while((NULL != obj->dma_ring) && (length > 0u) && (obj->dma_ring_used > 0u))
+    {
+        uint32_t chunk = obj->dma_ring_rd / CYHAL_UART_DMA_RING_CHUNK;
+        uint32_t offset = obj->dma_ring_rd % CYHAL_UART_DMA_RING_CHUNK;
+        uint32_t chunk_length = _cyhal_uart_dma_ring_chunk_length(obj, chunk);
+        uint32_t take = ((chunk_length - offset) < length) ? (chunk_length - offset) : (uint32_t)length;
+
+        obj->dma_ring_rd += take;
+        length -= take;
+        if((offset + take) == chunk_length)
+        {
+            /* Chunk fully consumed; hand it back to the DMA */
+            obj->dma_ring_rd = ((chunk + 1u) % obj->dma_ring_chunks) * CYHAL_UART_DMA_RING_CHUNK;
+            obj->dma_ring_used--;
+            if(chunk_length != CYHAL_UART_DMA_RING_CHUNK)
+            {
+                obj->dma_ring_short_head = (obj->dma_ring_short_head + 1u) % _CYHAL_UART_DMA_RING_MAX_SHORT;
+                obj->dma_ring_short_count--;
+            }
+        }
+    }
+
+    /* Resume reception if the ring had filled up */
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    if((NULL != obj->dma_ring) && !obj->dma_ring_inflight)
+    {
+        result = _cyhal_uart_dma_ring_next(obj);
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
+
+    if(result != CY_RSLT_SUCCESS)
+    {
+        _cyhal_uart_dma_ring_notify(obj, CYHAL_UART_IRQ_RX_ERROR);
+    }
+}
+
+cy_rslt_t cyhal_uart_dma_ring_flush(cyhal_uart_t *obj)
+{
+    CY_ASSERT(NULL != obj);
+
+    if(NULL == obj->dma_ring)
+    {
+        return CYHAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+    if(obj->dma_ring_inflight)
+    {
+        /* The DMA reads the FIFO until its chunk completes, the completion interrupt takes the tail */
+        obj->dma_ring_flush_pending = true;
+    }
+    else if(_cyhal_uart_dma_ring_flush_tail(obj))
+    {
+        result = _cyhal_uart_dma_ring_next(obj);
+    }
+    cyhal_system_critical_section_exit(savedIntrStatus);
     return result;
 }
 #endif
@@ -1457,7 +2216,11 @@ cy_rslt_t cyhal_uart_read_async(cyhal_uart_t *obj, void *rx, size_t length)
 
     cy_rslt_t result = CY_RSLT_SUCCESS;
     #if (CYHAL_DRIVER_AVAILABLE_DMA)
-    if(obj->async_mode == CYHAL_ASYNC_DMA)
+    if(NULL != obj->dma_ring)
+    {
+        result = CYHAL_UART_RSLT_ERR_UNSUPPORTED_OPERATION;
+    }
+    else if(obj->async_mode == CYHAL_ASYNC_DMA)
     {
         uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
         obj->async_rx_buff = rx;
@@ -1480,7 +2243,7 @@ bool cyhal_uart_is_tx_active(cyhal_uart_t *obj)
     #if (CYHAL_DRIVER_AVAILABLE_DMA)
             || (obj->async_tx_buff != NULL)
     #endif
-            ;
+            || (obj->tx_queue_head != NULL);
 }
 
 bool cyhal_uart_is_rx_active(cyhal_uart_t *obj)
@@ -1509,6 +2272,13 @@ cy_rslt_t cyhal_uart_write_abort(cyhal_uart_t *obj)
     {
         Cy_SCB_UART_AbortTransmit(obj->base, &(obj->context));
     }
+
+    /* Fail every queued request */
+    obj->tx_queue_busy = false;
+    while (NULL != obj->tx_queue_head)
+    {
+        _cyhal_uart_tx_queue_finish(obj, CYHAL_UART_IRQ_TX_ERROR);
+    }
     return CY_RSLT_SUCCESS;
 }
 
@@ -30,6 +30,7 @@
 #include "cyhal_utils.h"
 #include "cyhal_utils_impl.h"
 #include "cyhal_hwmgr.h"
+#include "cyhal_system.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -204,6 +205,104 @@ void _cyhal_utils_disconnect_and_free(cyhal_gpio_t pin)
     cyhal_hwmgr_free(&rsc);
 }
 
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+/* Blocking on a semaphore needs a calling thread, so interrupts and code that runs before the
+ * scheduler has started wait like on bare metal */
+static bool _cyhal_utils_wait_can_block(void)
+{
+    cy_thread_t thread = NULL;
+    return (__get_IPSR() == 0u) && (CY_RSLT_SUCCESS == cy_rtos_get_thread_handle(&thread)) && (NULL != thread);
+}
+#endif
+
+void _cyhal_utils_wait_arm(_cyhal_utils_wait_t *wait)
+{
+    wait->done = false;
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    if (wait->has_semaphore)
+    {
+        // Drop a signal that arrived after the previous operation timed out
+        (void) cy_rtos_get_semaphore(&wait->semaphore, 0u, (__get_IPSR() != 0u));
+    }
+    else if (_cyhal_utils_wait_can_block())
+    {
+        // Without a semaphore (e.g. out of memory) the bare metal wait below is used
+        wait->has_semaphore = (CY_RSLT_SUCCESS == cy_rtos_init_semaphore(&wait->semaphore, 1u, 0u));
+    }
+#endif
+}
+
+bool _cyhal_utils_wait_for(_cyhal_utils_wait_t *wait, uint32_t timeout_us)
+{
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    if (wait->has_semaphore && !wait->done && _cyhal_utils_wait_can_block())
+    {
+        // Round up so that a sub-millisecond timeout does not become a zero wait
+        (void) cy_rtos_get_semaphore(&wait->semaphore, (timeout_us + 999u) / 1000u, false);
+        return wait->done;
+    }
+#endif
+
+    // The cycle counter measures the timeout, as the CPU may be asleep for most of it
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    const uint32_t cycles_per_us = (SystemCoreClock + 999999u) / 1000000u;
+    const bool can_sleep = ((SysTick->CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk))
+                            == (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk)) && (__get_IPSR() == 0u);
+    uint64_t remaining = (uint64_t)timeout_us * cycles_per_us;
+    uint32_t last = DWT->CYCCNT;
+
+    while (!wait->done && (remaining > 0u))
+    {
+        if (can_sleep)
+        {
+            // WFI wakes on a pending interrupt even while interrupts are masked, so checking
+            // the flag inside the critical section cannot miss the completion.
+            uint32_t savedIntrStatus = cyhal_system_critical_section_enter();
+            if (!wait->done)
+            {
+                __WFI();
+            }
+            cyhal_system_critical_section_exit(savedIntrStatus);
+        }
+
+        uint32_t now = DWT->CYCCNT;
+        uint32_t elapsed = now - last;
+        last = now;
+        remaining = (remaining > elapsed) ? (remaining - elapsed) : 0u;
+    }
+
+    return wait->done;
+}
+
+void _cyhal_utils_wait_signal(_cyhal_utils_wait_t *wait)
+{
+    if (wait != NULL)
+    {
+        wait->done = true;
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+        if (wait->has_semaphore)
+        {
+            (void) cy_rtos_set_semaphore(&wait->semaphore, (__get_IPSR() != 0u));
+        }
+#endif
+    }
+}
+
+void _cyhal_utils_wait_free(_cyhal_utils_wait_t *wait)
+{
+#if defined(CY_RTOS_AWARE) || defined(COMPONENT_RTOS_AWARE)
+    if (wait->has_semaphore)
+    {
+        (void) cy_rtos_deinit_semaphore(&wait->semaphore);
+        wait->has_semaphore = false;
+    }
+#else
+    CY_UNUSED_PARAMETER(wait);
+#endif
+}
+
 #if defined(__cplusplus)
 }
 #endif